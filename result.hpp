@@ -1,334 +1,1585 @@
-#pragma once
-
-// Copyright © 2021 Alex Qzminsky.
-// License: MIT. All rights reserved.
-
-/// \brief Result variant type
-///
-/// \author https://github.com/qzminsky
-/// \version 1.0.0
-/// \date 2021/01/16
-
-#ifndef RESULT_H
-#define RESULT_H
-
-static_assert(__cplusplus >= 2017'00, "C++17 or higher is required");
-
-#include <type_traits>
-#include <variant>
-
-#if __cplusplus >= 2020'00
-#   include <concepts>
-#endif
-
-/**
- * \class result
- *
- * \brief Result monad implementation
- *
- * \details Stores an ok/error-state with corresponding value
-*/
-template <typename Ok_t = std::monostate,
-          typename Error_t = std::monostate
->
-class result
-{
-public:
-
-    // ANCHOR Member types
-    using ok_type    = Ok_t;
-    using error_type = Error_t;
-
-private:
-
-    // Value container
-    std::variant<ok_type, error_type> _value;
-
-public:
-
-    /// There is no default constructor for a result
-    result () = delete;
-
-    /// Default copy constructor
-    result (result const&) = default;
-
-    /// Default move constructor
-    result (result&&) = default;
-
-    /**
-     * \brief Converting constructor from specified value
-     *
-     * \param val Value to store in a result
-    */
-    template <typename T>
-    result (T const& val) : _value{ val } {}
-
-    /**
-     * \brief Converting constructor from ok-typed variant
-     *
-     * \param other Variant to construct from
-    */
-    template <typename Copy_Ok_t>
-    result (result<Copy_Ok_t, std::monostate> const& other) { *this = other; }
-
-    /**
-     * \brief Converting constructor from error-typed variant
-     *
-     * \param other Variant to construct from
-    */
-    template <typename Copy_Error_t>
-    result (result<std::monostate, Copy_Error_t> const& other) { *this = other; }
-
-    /// Default copy assignment
-    auto operator = (result const&) -> result& = default;
-
-    /// Default move assignment
-    auto operator = (result&&) -> result& = default;
-
-    /**
-     * \brief Converting assignment from ok-typed variant
-     *
-     * \param other Variant to extract value from
-    */
-    template <typename Copy_Ok_t>
-    auto operator = (result<Copy_Ok_t, std::monostate> const& other) -> result&
-    {
-        _value.template emplace<0>(other.unwrap());
-        return *this;
-    }
-
-    /**
-     * \brief Converting assignment from error-typed variant
-     *
-     * \param other Variant to extract value from
-    */
-    template <typename Copy_Error_t>
-    auto operator = (result<std::monostate, Copy_Error_t> const& other) -> result&
-    {
-        _value.template emplace<1>(other.unwrap_error());
-        return *this;
-    }
-
-    /**
-     * \brief Constructs a success result object with specified value
-     *
-     * \param val Success value stored in result
-    */
-    template <typename T>
-    static auto ok (T const& val) -> result<T, std::monostate>
-    {
-        return result<T, std::monostate>{ val };
-    }
-
-    /**
-     * \brief Constructs a failure result object with specified value
-     *
-     * \param val Failure value stored in result
-    */
-    template <typename T>
-    static auto error (T const& val) -> result<std::monostate, T>
-    {
-        return result<std::monostate, T>{ val };
-    }
-
-    /**
-     * \brief Predicate. Returns `true` in case of success result
-    */
-    [[nodiscard]]
-    auto is_ok () const noexcept -> bool
-    {
-        return _value.index() == 0;
-    }
-
-    /**
-     * \brief Predicate. Returns `true` in case of failure result
-    */
-    [[nodiscard]]
-    auto is_error () const noexcept -> bool
-    {
-        return _value.index() == 1;
-    }
-
-    /**
-     * \brief Predicate. Returns `true` in case of success result with matching values
-    */
-    template <typename T>
-    [[nodiscard]]
-    auto is_ok (T const& val) const noexcept -> bool
-    {
-        if constexpr (
-            std::is_same_v<ok_type, std::monostate> ||
-            std::is_same_v<T, std::monostate>
-        ) {
-            return false;
-        }
-        else return is_ok() && (unwrap() == val);
-    }
-
-    /**
-     * \brief Predicate. Returns `true` in case of failure result with matching values
-    */
-    template <typename T>
-    [[nodiscard]]
-    auto is_error (T const& val) const noexcept -> bool
-    {
-        if constexpr (
-            std::is_same_v<error_type, std::monostate> ||
-            std::is_same_v<T, std::monostate>
-        ) {
-            return false;
-        }
-        else return is_error() && (unwrap_error() == val);
-    }
-
-    /**
-     * \brief Predicate operator. Returns `true` in case of success result
-    */
-    [[nodiscard]]
-    explicit operator bool () const noexcept
-    {
-        return is_ok();
-    }
-
-    /**
-     * \brief Compares tho results by its states equality
-     *
-     * \param other Result to compare with
-     *
-     * \return `true` if comparing states is equal to each other; `false` otherwise
-    */
-    template <typename T1, typename T2>
-    [[nodiscard]]
-    auto operator == (result<T1, T2> const& other) const noexcept -> bool
-    {
-        return (is_ok() && other.is_ok(unwrap())) || (is_error() && other.is_error(unwrap_error()));
-    }
-
-#if __cplusplus < 2020'00
-    /**
-     * \brief Compares tho results by its states inequality
-     *
-     * \param other Result to compare with
-     *
-     * \return `true` if comparing states is not equal to each other; `false` otherwise
-    */
-    template <typename T1, typename T2>
-    [[nodiscard]]
-    auto operator != (result<T1, T2> const& other) const noexcept -> bool
-    {
-        return !(*this == other);
-    }
-#endif
-
-    /**
-     * \brief Extracts the stored value in case of success result and returns it
-     *
-     * \throw std::bad_variant_access
-    */
-    [[nodiscard]]
-    auto unwrap () const -> ok_type
-    {
-        return std::get<0>(_value);
-    }
-
-    /**
-     * \brief Extracts the stored value in case of failure result and returns it
-     *
-     * \throw std::bad_variant_access
-    */
-    [[nodiscard]]
-    auto unwrap_error () const -> error_type
-    {
-        return std::get<1>(_value);
-    }
-
-    /**
-     * \brief Extracts the stored vavlue in case of success result or a provided default otherwise
-     *
-     * \param def Default value for error case
-    */
-    [[nodiscard]]
-    auto unwrap_or (ok_type const& def) const -> ok_type
-    {
-        return is_ok() ? unwrap() : def;
-    }
-
-    /**
-     * \brief Performs specified execution in case of success result
-     *
-     * \param func Functor to invoke
-     *
-     * \return Reference to original result object
-    */
-#if __cplusplus >= 2020'00
-    template <typename Functor>
-    requires
-             std::invocable<Functor, ok_type> || std::invocable<Functor>
-#else
-    template <typename Functor,
-              typename = std::enable_if_t<std::disjunction_v<std::is_invocable<Functor, ok_type>, std::is_invocable<Functor>>>
-    >
-#endif
-    auto if_ok (Functor&& func) -> result&
-    {
-        if (is_ok()) {
-            if constexpr (std::is_invocable_v<Functor>) {
-                func();
-            }
-            else func(unwrap());
-        }
-        return *this;
-    }
-
-    /**
-     * \brief Performs specified execution in case of failure result
-     *
-     * \param func Functor to invoke
-     *
-     * \return Reference to original result object
-    */
-#if __cplusplus >= 2020'00
-    template <typename Functor>
-    requires
-             std::invocable<Functor, error_type> || std::invocable<Functor>
-#else
-    template <typename Functor,
-              typename = std::enable_if_t<std::disjunction_v<std::is_invocable<Functor, error_type>, std::is_invocable<Functor>>>
-    >
-#endif
-    auto if_error (Functor&& func) -> result&
-    {
-        if (is_error()) {
-            if constexpr (std::is_invocable_v<Functor>) {
-                func();
-            }
-            else func(unwrap_error());
-        }
-        return *this;
-    }
-
-};  // end class result
-
-#endif  // RESULT_H
-
-// MIT License
-//
-// Copyright (c) 2021 Alex Qzminsky
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
+#pragma once
+
+// Copyright © 2021 Alex Qzminsky.
+// License: MIT. All rights reserved.
+
+/// \brief Result variant type
+///
+/// \author https://github.com/qzminsky
+/// \version 1.0.0
+/// \date 2021/01/16
+
+#ifndef RESULT_H
+#define RESULT_H
+
+static_assert(__cplusplus >= 2017'00, "C++17 or higher is required");
+
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#ifndef RESULT_LIGHTWEIGHT
+#   include <variant>
+#endif
+
+#if defined(RESULT_LIGHTWEIGHT) && defined(RESULT_USE_STD_EXPECTED)
+#   error "RESULT_LIGHTWEIGHT and RESULT_USE_STD_EXPECTED select different storages"
+#endif
+
+#if defined(RESULT_USE_STD_EXPECTED) || (__cplusplus > 2020'02 && !defined(RESULT_LIGHTWEIGHT) && __has_include(<expected>))
+#   include <expected>
+#   ifdef __cpp_lib_expected
+#       define RESULT_EXPECTED
+#   elif defined(RESULT_USE_STD_EXPECTED)
+#       error "RESULT_USE_STD_EXPECTED requires std::expected"
+#   endif
+#endif
+
+#if __cplusplus >= 2020'00
+#   include <compare>
+#   ifndef RESULT_LIGHTWEIGHT
+#       include <concepts>
+#       define RESULT_CONCEPTS
+#   endif
+#endif
+
+#ifdef NDEBUG
+#   if defined(__GNUC__) || defined(__clang__)
+#       define RESULT_ASSUME(cond) (static_cast<bool>(cond) ? void(0) : __builtin_unreachable())
+#   elif defined(_MSC_VER)
+#       define RESULT_ASSUME(cond) __assume(cond)
+#   else
+#       define RESULT_ASSUME(cond) void(0)
+#   endif
+#else
+#   include <cassert>
+#   define RESULT_ASSUME(cond) assert(cond)
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#   define RESULT_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#elif defined(__cpp_lib_is_constant_evaluated)
+#   define RESULT_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#else
+#   define RESULT_CONSTANT_EVALUATED() false
+#endif
+
+#if defined(RESULT_INSTRUMENTATION) || defined(RESULT_TRACING)
+#   include <source_location>
+#   define RESULT_SITE_PARAM [[maybe_unused]] std::source_location const& site = std::source_location::current()
+#   define RESULT_SITE_PARAM_NEXT , RESULT_SITE_PARAM
+#   define RESULT_SITE_ARG_NEXT , site
+#else
+#   define RESULT_SITE_PARAM
+#   define RESULT_SITE_PARAM_NEXT
+#   define RESULT_SITE_ARG_NEXT
+#endif
+
+#ifdef RESULT_INSTRUMENTATION
+#   include "result_instrument.hpp"
+#   define RESULT_RECORD(cond, ev) ((cond) ? result_instrument::record(result_instrument::event::ev, site) : void(0))
+#else
+#   define RESULT_RECORD(cond, ev) void(0)
+#endif
+
+#ifdef RESULT_TRACING
+#   include "result_trace.hpp"
+#   define RESULT_TRACE(step, err) result_trace::emit(result_trace::kind::step, site, err)
+#else
+#   define RESULT_TRACE(step, err) void(0)
+#endif
+
+template <typename Ok_t, typename Error_t>
+class result;
+
+#ifdef RESULT_LIGHTWEIGHT
+/**
+ * \brief Empty value type used for the missing side of a result
+*/
+struct result_monostate
+{
+    constexpr auto operator == (result_monostate) const noexcept -> bool { return true; }
+    constexpr auto operator != (result_monostate) const noexcept -> bool { return false; }
+    constexpr auto operator <  (result_monostate) const noexcept -> bool { return false; }
+#if __cplusplus >= 2020'00
+    constexpr auto operator <=> (result_monostate const&) const noexcept -> std::strong_ordering = default;
+#endif
+};
+
+/**
+ * \brief Exception thrown on access to the value of a result in the other state
+*/
+class bad_result_access : public std::exception
+{
+public:
+
+    auto what () const noexcept -> char const* override { return "bad result access"; }
+};
+#else
+/// Empty value type used for the missing side of a result
+using result_monostate = std::monostate;
+
+/**
+ * \brief Exception thrown on access to the value of a result in the other state
+*/
+class bad_result_access : public std::bad_variant_access
+{
+public:
+
+    auto what () const noexcept -> char const* override { return "bad result access"; }
+};
+#endif
+
+namespace result_detail
+{
+#ifdef RESULT_USE_STD_EXPECTED
+    /// Payload storage based on `std::expected`; a result has the layout of the matching `std::expected`
+    template <typename Ok_t, typename Error_t>
+    class storage
+    {
+        std::expected<Ok_t, Error_t> _value;
+
+    public:
+
+        template <typename... Args>
+        constexpr explicit storage (std::in_place_index_t<0>, Args&&... args)
+            : _value{ std::in_place, std::forward<Args>(args)... }
+        {}
+
+        template <typename... Args>
+        constexpr explicit storage (std::in_place_index_t<1>, Args&&... args)
+            : _value{ std::unexpect, std::forward<Args>(args)... }
+        {}
+
+        constexpr auto index () const noexcept -> std::size_t { return _value.has_value() ? 0 : 1; }
+
+        template <std::size_t I>
+        constexpr auto get () & noexcept -> auto&
+        {
+            if constexpr (I == 0) return *_value;
+            else return _value.error();
+        }
+
+        template <std::size_t I>
+        constexpr auto get () const& noexcept -> auto const&
+        {
+            if constexpr (I == 0) return *_value;
+            else return _value.error();
+        }
+
+        template <std::size_t I>
+        constexpr auto get () && noexcept -> auto&&
+        {
+            if constexpr (I == 0) return *std::move(_value);
+            else return std::move(_value).error();
+        }
+
+        template <std::size_t I, typename... Args>
+        auto emplace (Args&&... args) -> void
+        {
+            if constexpr (I == 0) {
+                if constexpr (std::is_nothrow_constructible_v<Ok_t, Args...>) {
+                    _value.emplace(std::forward<Args>(args)...);
+                }
+                else _value = std::expected<Ok_t, Error_t>{ std::in_place, std::forward<Args>(args)... };
+            }
+            else _value = std::unexpected<Error_t>{ std::in_place, std::forward<Args>(args)... };
+        }
+    };
+#elif !defined(RESULT_LIGHTWEIGHT)
+    /// Payload storage based on `std::variant`
+    template <typename Ok_t, typename Error_t>
+    class storage
+    {
+        std::variant<Ok_t, Error_t> _value;
+
+    public:
+
+        template <std::size_t I, typename... Args>
+        constexpr explicit storage (std::in_place_index_t<I> tag, Args&&... args)
+            : _value{ tag, std::forward<Args>(args)... }
+        {}
+
+        constexpr auto index () const noexcept -> std::size_t { return _value.index(); }
+
+        template <std::size_t I>
+        constexpr auto get () & noexcept -> auto& { return _get<I>(_value); }
+
+        template <std::size_t I>
+        constexpr auto get () const& noexcept -> auto const& { return _get<I>(_value); }
+
+        template <std::size_t I>
+        constexpr auto get () && noexcept -> auto&& { return std::move(_get<I>(_value)); }
+
+        template <std::size_t I, typename... Args>
+        auto emplace (Args&&... args) -> void { _value.template emplace<I>(std::forward<Args>(args)...); }
+
+    private:
+
+        /**
+         * \brief Non-throwing access to the active alternative
+         *
+         * \details `std::get_if` keeps `__throw_bad_variant_access` out of the emitted code. GCC rejects its
+         * null check on a temporary during constant evaluation, so `std::get` is used there instead
+        */
+        template <std::size_t I, typename Variant>
+        static constexpr auto _get (Variant& value) noexcept -> auto&
+        {
+            if (RESULT_CONSTANT_EVALUATED()) return std::get<I>(value);
+            return *std::get_if<I>(&value);
+        }
+    };
+#else
+    /// Union of both payloads; trivially destructible if both payloads are
+    template <typename Ok_t, typename Error_t,
+              bool = std::is_trivially_destructible_v<Ok_t> && std::is_trivially_destructible_v<Error_t>
+    >
+    union payload
+    {
+        Ok_t ok;
+        Error_t error;
+
+        payload () noexcept {}
+
+        template <typename... Args>
+        constexpr explicit payload (std::in_place_index_t<0>, Args&&... args) : ok(std::forward<Args>(args)...) {}
+
+        template <typename... Args>
+        constexpr explicit payload (std::in_place_index_t<1>, Args&&... args) : error(std::forward<Args>(args)...) {}
+    };
+
+    template <typename Ok_t, typename Error_t>
+    union payload<Ok_t, Error_t, false>
+    {
+        Ok_t ok;
+        Error_t error;
+
+        payload () noexcept {}
+
+        template <typename... Args>
+        constexpr explicit payload (std::in_place_index_t<0>, Args&&... args) : ok(std::forward<Args>(args)...) {}
+
+        template <typename... Args>
+        constexpr explicit payload (std::in_place_index_t<1>, Args&&... args) : error(std::forward<Args>(args)...) {}
+
+        ~payload () {}
+    };
+
+    /// Tagged union storage without `std::variant`
+    template <typename Ok_t, typename Error_t>
+    class storage_base
+    {
+    protected:
+
+        payload<Ok_t, Error_t> _payload;
+        bool _is_error;
+
+        struct uninitialized {};
+
+        explicit storage_base (uninitialized) noexcept {}
+
+        // Destroys the active payload
+        auto _destroy () noexcept -> void
+        {
+            if (_is_error) {
+                _payload.error.~Error_t();
+            }
+            else _payload.ok.~Ok_t();
+        }
+
+        // Constructs the specified payload over a destroyed one
+        template <std::size_t I, typename... Args>
+        auto _construct (Args&&... args) -> void
+        {
+            if constexpr (I == 0) {
+                ::new (static_cast<void*>(std::addressof(_payload.ok))) Ok_t(std::forward<Args>(args)...);
+            }
+            else ::new (static_cast<void*>(std::addressof(_payload.error))) Error_t(std::forward<Args>(args)...);
+
+            _is_error = I == 1;
+        }
+
+        // Copies or moves the payload of another storage over a destroyed one
+        template <typename Other>
+        auto _construct_from (Other&& other) -> void
+        {
+            if (other._is_error) {
+                _construct<1>(std::forward<Other>(other).template get<1>());
+            }
+            else _construct<0>(std::forward<Other>(other).template get<0>());
+        }
+
+        // Assigns the payload of another storage
+        template <typename Other>
+        auto _assign_from (Other&& other) -> void
+        {
+            if (_is_error == other._is_error) {
+                if (_is_error) {
+                    _payload.error = std::forward<Other>(other).template get<1>();
+                }
+                else _payload.ok = std::forward<Other>(other).template get<0>();
+            }
+            else if (other._is_error) {
+                emplace<1>(std::forward<Other>(other).template get<1>());
+            }
+            else emplace<0>(std::forward<Other>(other).template get<0>());
+        }
+
+    public:
+
+        template <std::size_t I, typename... Args>
+        constexpr explicit storage_base (std::in_place_index_t<I> tag, Args&&... args)
+            : _payload(tag, std::forward<Args>(args)...)
+            , _is_error{ I == 1 }
+        {}
+
+        constexpr auto index () const noexcept -> std::size_t { return _is_error; }
+
+        template <std::size_t I>
+        constexpr auto get () & noexcept -> auto&
+        {
+            if constexpr (I == 0) return _payload.ok; else return _payload.error;
+        }
+
+        template <std::size_t I>
+        constexpr auto get () const& noexcept -> auto const&
+        {
+            if constexpr (I == 0) return _payload.ok; else return _payload.error;
+        }
+
+        template <std::size_t I>
+        constexpr auto get () && noexcept -> auto&&
+        {
+            if constexpr (I == 0) return std::move(_payload.ok); else return std::move(_payload.error);
+        }
+
+        /// Replaces the payload. A throwing constructor leaves the old payload intact; a throwing move doesn't
+        template <std::size_t I, typename... Args>
+        auto emplace (Args&&... args) -> void
+        {
+            using type = std::conditional_t<I == 0, Ok_t, Error_t>;
+
+            if constexpr (std::is_nothrow_constructible_v<type, Args...>) {
+                _destroy();
+                _construct<I>(std::forward<Args>(args)...);
+            }
+            else {
+                auto temp = type(std::forward<Args>(args)...);
+
+                _destroy();
+                _construct<I>(std::move(temp));
+            }
+        }
+    };
+
+    /// Storage of trivially copyable payloads; stays trivially copyable itself
+    template <typename Ok_t, typename Error_t,
+              bool = std::is_trivially_copyable_v<Ok_t> && std::is_trivially_copyable_v<Error_t>
+    >
+    class storage : public storage_base<Ok_t, Error_t>
+    {
+    public:
+
+        using storage_base<Ok_t, Error_t>::storage_base;
+    };
+
+    /// Storage of payloads with non-trivial copy, move or destruction
+    template <typename Ok_t, typename Error_t>
+    class storage<Ok_t, Error_t, false> : public storage_base<Ok_t, Error_t>
+    {
+        using base = storage_base<Ok_t, Error_t>;
+
+    public:
+
+        using base::base;
+
+        storage (storage const& other) : base{ typename base::uninitialized{} }
+        {
+            this->_construct_from(other);
+        }
+
+        storage (storage&& other)
+            noexcept(std::is_nothrow_move_constructible_v<Ok_t> && std::is_nothrow_move_constructible_v<Error_t>)
+            : base{ typename base::uninitialized{} }
+        {
+            this->_construct_from(std::move(other));
+        }
+
+        auto operator = (storage const& other) -> storage&
+        {
+            if (this != &other) this->_assign_from(other);
+            return *this;
+        }
+
+        auto operator = (storage&& other)
+            noexcept(std::is_nothrow_move_constructible_v<Ok_t> && std::is_nothrow_move_assignable_v<Ok_t> &&
+                     std::is_nothrow_move_constructible_v<Error_t> && std::is_nothrow_move_assignable_v<Error_t>)
+            -> storage&
+        {
+            if (this != &other) this->_assign_from(std::move(other));
+            return *this;
+        }
+
+        ~storage ()
+        {
+            this->_destroy();
+        }
+    };
+#endif
+
+    /// Throws an exception on access to the value of a result in the other state
+    [[noreturn]]
+    inline auto throw_bad_access () -> void
+    {
+        throw bad_result_access{};
+    }
+
+    /// Throws the error value of a result; a `std::exception_ptr` is rethrown
+    template <typename Error_t>
+    [[noreturn]]
+    auto throw_error (Error_t&& err) -> void
+    {
+        if constexpr (std::is_same_v<std::decay_t<Error_t>, std::exception_ptr>) {
+            if (!err) throw_bad_access();
+            std::rethrow_exception(err);
+        }
+        else throw std::forward<Error_t>(err);
+    }
+
+    /// Internal accessor to a result's payload without a state check
+    struct access
+    {
+        template <std::size_t I, typename Result>
+        static constexpr auto get (Result&& res) noexcept -> decltype(auto)
+        {
+            if constexpr (std::is_lvalue_reference_v<Result>) {
+                return res._value.template get<I>();
+            }
+            else return std::move(res._value).template get<I>();
+        }
+    };
+
+    /// Accesses a result's payload with a state check
+    template <std::size_t I, typename Result>
+    constexpr auto checked_get (Result&& res) -> decltype(auto)
+    {
+        if (res.is_ok() != (I == 0)) {
+            throw_bad_access();
+        }
+        return access::get<I>(std::forward<Result>(res));
+    }
+
+    /// Constructs a value by the uses-allocator convention: leading `std::allocator_arg`, trailing allocator, or none
+    template <typename T, typename Alloc, typename... Args>
+    constexpr auto make_using_allocator (Alloc const& alloc, Args&&... args) -> T
+    {
+        if constexpr (!std::uses_allocator_v<T, Alloc>) {
+            return T(std::forward<Args>(args)...);
+        }
+        else if constexpr (std::is_constructible_v<T, std::allocator_arg_t, Alloc const&, Args...>) {
+            return T(std::allocator_arg, alloc, std::forward<Args>(args)...);
+        }
+        else {
+            static_assert(std::is_constructible_v<T, Args..., Alloc const&>, "The value can't be constructed with the allocator");
+
+            return T(std::forward<Args>(args)..., alloc);
+        }
+    }
+
+    template <typename T>
+    struct array_of_one { T value[1]; };
+
+    /// Checks that `T` converts to `Alternative` without narrowing (P0608)
+    template <typename Alternative, typename T, typename = void>
+    struct is_non_narrowing : std::false_type {};
+
+    template <typename Alternative, typename T>
+    struct is_non_narrowing<Alternative, T, std::void_t<decltype(array_of_one<Alternative>{{ std::declval<T>() }})>>
+        : std::true_type {};
+
+    /// Candidate of the alternative selection; `bool` only accepts a `bool` source, as in `std::variant`
+    template <std::size_t I, typename Alternative, typename T,
+              bool = std::is_same_v<std::remove_cv_t<Alternative>, bool>
+                  ? std::is_same_v<std::remove_cv_t<std::remove_reference_t<T>>, bool>
+                  : is_non_narrowing<Alternative, T>::value
+    >
+    struct alternative
+    {
+        static auto select () -> void;
+    };
+
+    template <std::size_t I, typename Alternative, typename T>
+    struct alternative<I, Alternative, T, true>
+    {
+        static auto select (Alternative) -> std::integral_constant<std::size_t, I>;
+    };
+
+    template <typename Ok_t, typename Error_t, typename T>
+    struct alternatives : alternative<0, Ok_t, T>, alternative<1, Error_t, T>
+    {
+        using alternative<0, Ok_t, T>::select;
+        using alternative<1, Error_t, T>::select;
+    };
+
+    /// Selects the alternative a value converts to, like the converting constructor of `std::variant` does
+    template <typename T, typename Ok_t, typename Error_t, typename = void>
+    struct select_alternative {};
+
+    template <typename T, typename Ok_t, typename Error_t>
+    struct select_alternative<T, Ok_t, Error_t, std::void_t<decltype(alternatives<Ok_t, Error_t, T>::select(std::declval<T>()))>>
+        : decltype(alternatives<Ok_t, Error_t, T>::select(std::declval<T>()))
+    {};
+
+    /// Checks if a two-state result converts into another one value by value, without narrowing
+    template <typename From, typename To, typename = void>
+    struct is_result_convertible : std::false_type {};
+
+    template <typename From, typename To>
+    struct is_result_convertible<From, To, std::enable_if_t<
+        !std::is_same_v<std::decay_t<From>, To> &&
+        !std::is_same_v<typename std::decay_t<From>::ok_type, result_monostate> &&
+        !std::is_same_v<typename std::decay_t<From>::error_type, result_monostate>
+    >> : std::bool_constant<
+        std::is_convertible_v<decltype(access::get<0>(std::declval<From>())), typename To::ok_type> &&
+        std::is_convertible_v<decltype(access::get<1>(std::declval<From>())), typename To::error_type> &&
+        is_non_narrowing<typename To::ok_type, decltype(access::get<0>(std::declval<From>()))>::value &&
+        is_non_narrowing<typename To::error_type, decltype(access::get<1>(std::declval<From>()))>::value
+    > {};
+
+    template <typename From, typename To>
+    inline constexpr bool is_result_convertible_v = is_result_convertible<From, To>::value;
+
+    template <typename T>
+    struct is_in_place_index : std::false_type {};
+
+    template <std::size_t I>
+    struct is_in_place_index<std::in_place_index_t<I>> : std::true_type {};
+
+    /// Checks if the type is a specialization of `result`
+    template <typename T>
+    struct is_result : std::false_type {};
+
+    template <typename Ok_t, typename Error_t>
+    struct is_result<result<Ok_t, Error_t>> : std::true_type {};
+
+    template <typename T>
+    inline constexpr bool is_result_v = is_result<std::remove_cv_t<std::remove_reference_t<T>>>::value;
+
+#ifdef RESULT_EXPECTED
+    /// Value type of a result matching `std::expected<T, E>`: `void` maps to `result_monostate`
+    template <typename T>
+    using expected_value_t = std::conditional_t<std::is_void_v<T>, result_monostate, T>;
+
+    /// Builds the payload storage from a `std::expected`
+    template <typename Storage, typename Expected>
+    auto from_expected (Expected&& other) -> Storage
+    {
+        if (other.has_value()) {
+            if constexpr (std::is_void_v<typename std::remove_cvref_t<Expected>::value_type>) {
+                return Storage{ std::in_place_index<0> };
+            }
+            else return Storage{ std::in_place_index<0>, *std::forward<Expected>(other) };
+        }
+        return Storage{ std::in_place_index<1>, std::forward<Expected>(other).error() };
+    }
+#endif
+
+    /// Invokes the functor with the value if it accepts one, or without arguments otherwise
+    template <typename Functor, typename T>
+    auto invoke_optional (Functor&& func, T&& val) -> decltype(auto)
+    {
+        if constexpr (std::is_invocable_v<Functor, T>) {
+            return std::forward<Functor>(func)(std::forward<T>(val));
+        }
+        else return std::forward<Functor>(func)();
+    }
+
+    template <typename Functor, typename T>
+    using invoke_optional_t = decltype(invoke_optional(std::declval<Functor>(), std::declval<T>()));
+
+    /// Payload type of the `I`-th result for the combined state `Mask`
+    template <std::size_t Mask, std::size_t I, typename Tuple>
+    using payload_t = decltype(access::get<(Mask >> I) & 1u>(std::declval<std::tuple_element_t<I, Tuple>>()));
+
+    template <std::size_t Mask, typename Functor, typename Tuple, typename Indices>
+    struct case_result;
+
+    template <std::size_t Mask, typename Functor, typename Tuple, std::size_t... I>
+    struct case_result<Mask, Functor, Tuple, std::index_sequence<I...>>
+    {
+        using type = std::invoke_result_t<Functor, payload_t<Mask, I, Tuple>...>;
+    };
+
+    template <typename Functor, typename Tuple, typename Masks, typename Indices>
+    struct match_result;
+
+    template <typename Functor, typename Tuple, std::size_t... Mask, typename Indices>
+    struct match_result<Functor, Tuple, std::index_sequence<Mask...>, Indices>
+    {
+        using type = std::common_type_t<typename case_result<Mask, Functor, Tuple, Indices>::type...>;
+    };
+
+    /// Invokes the functor with the payloads selected by the combined state `Mask`
+    template <typename Ret, std::size_t Mask, typename Functor, typename Tuple, std::size_t... I>
+    auto match_case (Functor&& func, Tuple&& refs, std::index_sequence<I...>) -> Ret
+    {
+        return std::forward<Functor>(func)(
+            access::get<(Mask >> I) & 1u>(std::get<I>(std::move(refs)))...
+        );
+    }
+
+    /// Tests the combined states one by one, so every case stays visible to the inliner
+    template <typename Ret, std::size_t Mask, std::size_t... Rest, typename Functor, typename Tuple, typename Indices>
+    auto match_dispatch (std::size_t state, Functor&& func, Tuple&& refs, Indices indices) -> Ret
+    {
+        if constexpr (sizeof...(Rest) == 0) {
+            RESULT_ASSUME(state == Mask);
+            return match_case<Ret, Mask>(std::forward<Functor>(func), std::move(refs), indices);
+        }
+        else {
+            if (state == Mask) {
+                return match_case<Ret, Mask>(std::forward<Functor>(func), std::move(refs), indices);
+            }
+            return match_dispatch<Ret, Rest...>(state, std::forward<Functor>(func), std::move(refs), indices);
+        }
+    }
+
+    /// Dispatches over the combined state of all results
+    template <typename Functor, typename Tuple, std::size_t... Mask, std::size_t... I>
+    auto match_all (Functor&& func, Tuple&& refs, std::index_sequence<Mask...>, std::index_sequence<I...> indices)
+        -> typename match_result<Functor, Tuple, std::index_sequence<Mask...>, std::index_sequence<I...>>::type
+    {
+        using ret_type = typename match_result<Functor, Tuple, std::index_sequence<Mask...>, std::index_sequence<I...>>::type;
+
+        auto const state = ((std::size_t{ std::get<I>(refs).is_error() } << I) | ...);
+
+        return match_dispatch<ret_type, Mask...>(state, std::forward<Functor>(func), std::move(refs), indices);
+    }
+
+    /// Checks that all but the last arguments of the free `match` are results
+    template <typename... Args>
+    struct is_match_args : std::false_type {};
+
+    template <typename Result, typename Functor>
+    struct is_match_args<Result, Functor> : std::bool_constant<is_result_v<Result> && !is_result_v<Functor>> {};
+
+    template <typename Result, typename Next, typename... Rest>
+    struct is_match_args<Result, Next, Rest...>
+        : std::bool_constant<is_result_v<Result> && is_match_args<Next, Rest...>::value> {};
+
+    template <typename Functor, typename Tuple, std::size_t... I>
+    auto match_forward (Functor&& func, Tuple&& refs, std::index_sequence<I...> indices) -> decltype(auto)
+    {
+        using result_refs = std::tuple<std::tuple_element_t<I, std::remove_reference_t<Tuple>>...>;
+
+        return match_all(
+            std::forward<Functor>(func),
+            result_refs{ std::get<I>(std::move(refs))... },
+            std::make_index_sequence<std::size_t{ 1 } << sizeof...(I)>{},
+            indices
+        );
+    }
+
+}   // end namespace result_detail
+
+/**
+ * \class result
+ *
+ * \brief Result monad implementation
+ *
+ * \details Stores an ok/error-state with corresponding value
+*/
+template <typename Ok_t = result_monostate,
+          typename Error_t = result_monostate
+>
+class result
+{
+public:
+
+    // ANCHOR Member types
+    using ok_type    = Ok_t;
+    using error_type = Error_t;
+
+private:
+
+    // Value container
+    result_detail::storage<ok_type, error_type> _value;
+
+    friend struct result_detail::access;
+
+    // Value type of the specified state
+    template <std::size_t I>
+    using _alternative_t = std::conditional_t<I == 0, ok_type, error_type>;
+
+public:
+
+    /// There is no default constructor for a result
+    result () = delete;
+
+    /// Default copy constructor
+    result (result const&) = default;
+
+    /// Default move constructor
+    result (result&&) = default;
+
+    /**
+     * \brief Converting constructor from specified value
+     *
+     * \details The stored state is selected like `std::variant` selects its alternative
+     *
+     * \param val Value to store in a result
+    */
+    template <typename T,
+              typename = std::enable_if_t<!result_detail::is_result_v<T> &&
+                                          !result_detail::is_in_place_index<std::decay_t<T>>::value>,
+              std::size_t I = result_detail::select_alternative<T&&, ok_type, error_type>::value
+    >
+    constexpr result (T&& val) : _value{ std::in_place_index<I>, std::forward<T>(val) } {}
+
+    /**
+     * \brief Constructs the value of the specified state in place
+     *
+     * \param tag State index: `0` for success, `1` for failure
+     * \param args Arguments to construct the value from
+    */
+    template <std::size_t I, typename... Args>
+    constexpr explicit result (std::in_place_index_t<I> tag, Args&&... args) : _value{ tag, std::forward<Args>(args)... } {}
+
+    /**
+     * \brief Constructs the value of the specified state in place with the allocator
+     *
+     * \details The value is constructed by the uses-allocator convention, so allocator-aware values,
+     * e.g. `std::pmr` containers, get the memory resource
+     *
+     * \param alloc Allocator to pass to the value
+     * \param tag State index: `0` for success, `1` for failure
+     * \param args Arguments to construct the value from
+    */
+    template <typename Alloc, std::size_t I, typename... Args>
+    constexpr result (std::allocator_arg_t, Alloc const& alloc, std::in_place_index_t<I> tag, Args&&... args)
+        : _value{ tag, result_detail::make_using_allocator<_alternative_t<I>>(alloc, std::forward<Args>(args)...) }
+    {}
+
+    /**
+     * \brief Copies, moves or converts a result, or converts a value, with the allocator
+     *
+     * \details Unlike the copy constructor of an allocator-aware value, which gets the default
+     * allocator, the copy is constructed with the specified one. Containers constructing their
+     * elements with the uses-allocator convention call this constructor
+     *
+     * \param alloc Allocator to pass to the value
+     * \param other Result or value to construct from
+     *
+     * \throw bad_result_access if a single-state result is in the other state
+    */
+    template <typename Alloc, typename T,
+              typename = std::enable_if_t<!result_detail::is_in_place_index<std::decay_t<T>>::value>
+    >
+    result (std::allocator_arg_t, Alloc const& alloc, T&& other) : result{ _with_allocator(alloc, std::forward<T>(other)) } {}
+
+    /**
+     * \brief Converting constructor from ok-typed variant
+     *
+     * \param other Variant to construct from
+     *
+     * \throw bad_result_access
+    */
+    template <typename Copy_Ok_t>
+    result (result<Copy_Ok_t, result_monostate> const& other)
+        : _value{ std::in_place_index<0>, result_detail::checked_get<0>(other) }
+    {}
+
+    /**
+     * \brief Converting constructor from ok-typed variant with the value moving
+     *
+     * \param other Variant to construct from
+     *
+     * \throw bad_result_access
+    */
+    template <typename Move_Ok_t>
+    result (result<Move_Ok_t, result_monostate>&& other)
+        : _value{ std::in_place_index<0>, result_detail::checked_get<0>(std::move(other)) }
+    {}
+
+    /**
+     * \brief Converting constructor from error-typed variant
+     *
+     * \param other Variant to construct from
+     *
+     * \throw bad_result_access
+    */
+    template <typename Copy_Error_t>
+    result (result<result_monostate, Copy_Error_t> const& other)
+        : _value{ std::in_place_index<1>, result_detail::checked_get<1>(other) }
+    {}
+
+    /**
+     * \brief Converting constructor from error-typed variant with the value moving
+     *
+     * \param other Variant to construct from
+     *
+     * \throw bad_result_access
+    */
+    template <typename Move_Error_t>
+    result (result<result_monostate, Move_Error_t>&& other)
+        : _value{ std::in_place_index<1>, result_detail::checked_get<1>(std::move(other)) }
+    {}
+
+    /**
+     * \brief Converting constructor from a result of other value types, e.g. of a narrower error type
+     *
+     * \details Enabled if both values are implicitly convertible
+     *
+     * \param other Result to construct from
+    */
+    template <typename Copy_Ok_t, typename Copy_Error_t,
+              typename = std::enable_if_t<result_detail::is_result_convertible_v<result<Copy_Ok_t, Copy_Error_t> const&, result>>
+    >
+    result (result<Copy_Ok_t, Copy_Error_t> const& other) : result{ _convert(other) } {}
+
+    /**
+     * \brief Converting constructor from a result of other value types with the value moving
+     *
+     * \details Enabled if both values are implicitly convertible
+     *
+     * \param other Result to construct from
+    */
+    template <typename Move_Ok_t, typename Move_Error_t,
+              typename = std::enable_if_t<result_detail::is_result_convertible_v<result<Move_Ok_t, Move_Error_t>&&, result>>
+    >
+    result (result<Move_Ok_t, Move_Error_t>&& other) : result{ _convert(std::move(other)) } {}
+
+    /// Default copy assignment
+    auto operator = (result const&) -> result& = default;
+
+    /// Default move assignment
+    auto operator = (result&&) -> result& = default;
+
+    /**
+     * \brief Converting assignment from ok-typed variant
+     *
+     * \param other Variant to extract value from
+     *
+     * \throw bad_result_access
+    */
+    template <typename Copy_Ok_t>
+    auto operator = (result<Copy_Ok_t, result_monostate> const& other) -> result&
+    {
+        _value.template emplace<0>(result_detail::checked_get<0>(other));
+        return *this;
+    }
+
+    /**
+     * \brief Converting assignment from ok-typed variant with the value moving
+     *
+     * \param other Variant to extract value from
+     *
+     * \throw bad_result_access
+    */
+    template <typename Move_Ok_t>
+    auto operator = (result<Move_Ok_t, result_monostate>&& other) -> result&
+    {
+        _value.template emplace<0>(result_detail::checked_get<0>(std::move(other)));
+        return *this;
+    }
+
+    /**
+     * \brief Converting assignment from error-typed variant
+     *
+     * \param other Variant to extract value from
+     *
+     * \throw bad_result_access
+    */
+    template <typename Copy_Error_t>
+    auto operator = (result<result_monostate, Copy_Error_t> const& other) -> result&
+    {
+        _value.template emplace<1>(result_detail::checked_get<1>(other));
+        return *this;
+    }
+
+    /**
+     * \brief Converting assignment from error-typed variant with the value moving
+     *
+     * \param other Variant to extract value from
+     *
+     * \throw bad_result_access
+    */
+    template <typename Move_Error_t>
+    auto operator = (result<result_monostate, Move_Error_t>&& other) -> result&
+    {
+        _value.template emplace<1>(result_detail::checked_get<1>(std::move(other)));
+        return *this;
+    }
+
+#ifdef RESULT_EXPECTED
+    /**
+     * \brief Converting constructor from `std::expected`. Moves the payload
+     *
+     * \details `std::expected<void, E>` converts to a result with `result_monostate` value type.
+     * Implicit if both payloads are implicitly convertible
+     *
+     * \param other Expected object to construct from
+    */
+    template <typename Exp_Ok_t, typename Exp_Error_t>
+    requires
+             std::constructible_from<ok_type, result_detail::expected_value_t<Exp_Ok_t>> &&
+             std::constructible_from<error_type, Exp_Error_t>
+    explicit(!std::is_convertible_v<result_detail::expected_value_t<Exp_Ok_t>, ok_type> ||
+             !std::is_convertible_v<Exp_Error_t, error_type>)
+    result (std::expected<Exp_Ok_t, Exp_Error_t>&& other)
+        : _value{ result_detail::from_expected<result_detail::storage<ok_type, error_type>>(std::move(other)) }
+    {}
+
+    /**
+     * \brief Converting constructor from `std::expected`. Copies the payload
+     *
+     * \param other Expected object to construct from
+    */
+    template <typename Exp_Ok_t, typename Exp_Error_t>
+    requires
+             std::constructible_from<ok_type, result_detail::expected_value_t<Exp_Ok_t> const&> &&
+             std::constructible_from<error_type, Exp_Error_t const&>
+    explicit(!std::is_convertible_v<result_detail::expected_value_t<Exp_Ok_t> const&, ok_type> ||
+             !std::is_convertible_v<Exp_Error_t const&, error_type>)
+    result (std::expected<Exp_Ok_t, Exp_Error_t> const& other)
+        : _value{ result_detail::from_expected<result_detail::storage<ok_type, error_type>>(other) }
+    {}
+#endif
+
+    /**
+     * \brief Constructs a success result object with specified value
+     *
+     * \param val Success value stored in result
+    */
+    template <typename T>
+    static constexpr auto ok (T&& val) -> result<std::decay_t<T>, result_monostate>
+    {
+        return result<std::decay_t<T>, result_monostate>{ std::in_place_index<0>, std::forward<T>(val) };
+    }
+
+    /**
+     * \brief Constructs a failure result object with specified value
+     *
+     * \param val Failure value stored in result
+    */
+    template <typename T>
+    static constexpr auto error (T&& val RESULT_SITE_PARAM_NEXT) -> result<result_monostate, std::decay_t<T>>
+    {
+        auto res = result<result_monostate, std::decay_t<T>>{ std::in_place_index<1>, std::forward<T>(val) };
+
+        RESULT_RECORD(true, error_created);
+        RESULT_TRACE(created, result_detail::access::get<1>(res));
+        return res;
+    }
+
+    /**
+     * \brief Predicate. Returns `true` in case of success result
+    */
+    [[nodiscard]]
+    constexpr auto is_ok () const noexcept -> bool
+    {
+        return _value.index() == 0;
+    }
+
+    /**
+     * \brief Predicate. Returns `true` in case of failure result
+    */
+    [[nodiscard]]
+    constexpr auto is_error () const noexcept -> bool
+    {
+        return _value.index() == 1;
+    }
+
+    /**
+     * \brief Predicate. Returns `true` in case of success result with matching values
+    */
+    template <typename T>
+    [[nodiscard]]
+    auto is_ok (T const& val) const noexcept -> bool
+    {
+        if constexpr (
+            std::is_same_v<ok_type, result_monostate> ||
+            std::is_same_v<T, result_monostate>
+        ) {
+            return false;
+        }
+        else return is_ok() && (result_detail::access::get<0>(*this) == val);
+    }
+
+    /**
+     * \brief Predicate. Returns `true` in case of failure result with matching values
+    */
+    template <typename T>
+    [[nodiscard]]
+    auto is_error (T const& val) const noexcept -> bool
+    {
+        if constexpr (
+            std::is_same_v<error_type, result_monostate> ||
+            std::is_same_v<T, result_monostate>
+        ) {
+            return false;
+        }
+        else return is_error() && (result_detail::access::get<1>(*this) == val);
+    }
+
+    /**
+     * \brief Predicate operator. Returns `true` in case of success result
+    */
+    [[nodiscard]]
+    constexpr explicit operator bool () const noexcept
+    {
+        return is_ok();
+    }
+
+#ifdef RESULT_EXPECTED
+    /**
+     * \brief Converts to `std::expected`. Moves the payload
+     *
+     * \details A result with `result_monostate` value type converts to `std::expected<void, E>`.
+     * Implicit if both payloads are implicitly convertible
+    */
+    template <typename Exp_Ok_t, typename Exp_Error_t>
+    requires
+             (std::is_void_v<Exp_Ok_t> ? std::is_same_v<ok_type, result_monostate> : std::constructible_from<Exp_Ok_t, ok_type>) &&
+             std::constructible_from<Exp_Error_t, error_type>
+    explicit(!(std::is_void_v<Exp_Ok_t> || std::is_convertible_v<ok_type, Exp_Ok_t>) ||
+             !std::is_convertible_v<error_type, Exp_Error_t>)
+    operator std::expected<Exp_Ok_t, Exp_Error_t> () &&
+    {
+        if (is_error()) {
+            return std::expected<Exp_Ok_t, Exp_Error_t>{ std::unexpect, result_detail::access::get<1>(std::move(*this)) };
+        }
+        if constexpr (std::is_void_v<Exp_Ok_t>) {
+            return std::expected<Exp_Ok_t, Exp_Error_t>{};
+        }
+        else return std::expected<Exp_Ok_t, Exp_Error_t>{ std::in_place, result_detail::access::get<0>(std::move(*this)) };
+    }
+
+    /**
+     * \brief Converts to `std::expected`. Copies the payload
+    */
+    template <typename Exp_Ok_t, typename Exp_Error_t>
+    requires
+             (std::is_void_v<Exp_Ok_t> ? std::is_same_v<ok_type, result_monostate> : std::constructible_from<Exp_Ok_t, ok_type const&>) &&
+             std::constructible_from<Exp_Error_t, error_type const&>
+    explicit(!(std::is_void_v<Exp_Ok_t> || std::is_convertible_v<ok_type const&, Exp_Ok_t>) ||
+             !std::is_convertible_v<error_type const&, Exp_Error_t>)
+    operator std::expected<Exp_Ok_t, Exp_Error_t> () const&
+    {
+        if (is_error()) {
+            return std::expected<Exp_Ok_t, Exp_Error_t>{ std::unexpect, result_detail::access::get<1>(*this) };
+        }
+        if constexpr (std::is_void_v<Exp_Ok_t>) {
+            return std::expected<Exp_Ok_t, Exp_Error_t>{};
+        }
+        else return std::expected<Exp_Ok_t, Exp_Error_t>{ std::in_place, result_detail::access::get<0>(*this) };
+    }
+#endif
+
+    /**
+     * \brief Compares tho results by its states equality
+     *
+     * \param other Result to compare with
+     *
+     * \return `true` if comparing states is equal to each other; `false` otherwise
+    */
+    template <typename T1, typename T2>
+    [[nodiscard]]
+    auto operator == (result<T1, T2> const& other) const noexcept -> bool
+    {
+        return (is_ok() && other.is_ok(result_detail::access::get<0>(*this))) ||
+               (is_error() && other.is_error(result_detail::access::get<1>(*this)));
+    }
+
+#if __cplusplus >= 2020'00
+    /**
+     * \brief Orders tho results: any success result precedes any failure one; equal states are ordered by its values
+     *
+     * \param other Result to compare with
+    */
+    template <typename Cmp_Ok_t = ok_type, typename Cmp_Error_t = error_type>
+    requires
+             std::three_way_comparable<Cmp_Ok_t> && std::three_way_comparable<Cmp_Error_t>
+    [[nodiscard]]
+    auto operator <=> (result const& other) const
+        noexcept(noexcept(std::declval<Cmp_Ok_t const&>() <=> std::declval<Cmp_Ok_t const&>()) &&
+                 noexcept(std::declval<Cmp_Error_t const&>() <=> std::declval<Cmp_Error_t const&>()))
+        -> std::common_comparison_category_t<
+            std::compare_three_way_result_t<Cmp_Ok_t>,
+            std::compare_three_way_result_t<Cmp_Error_t>
+        >
+    {
+        if (is_ok() != other.is_ok()) {
+            return other.is_ok() <=> is_ok();
+        }
+        if (is_ok()) {
+            return result_detail::access::get<0>(*this) <=> result_detail::access::get<0>(other);
+        }
+        return result_detail::access::get<1>(*this) <=> result_detail::access::get<1>(other);
+    }
+#else
+    /**
+     * \brief Compares tho results by its states inequality
+     *
+     * \param other Result to compare with
+     *
+     * \return `true` if comparing states is not equal to each other; `false` otherwise
+    */
+    template <typename T1, typename T2>
+    [[nodiscard]]
+    auto operator != (result<T1, T2> const& other) const noexcept -> bool
+    {
+        return !(*this == other);
+    }
+
+    /**
+     * \brief Orders tho results: any success result precedes any failure one; equal states are ordered by its values
+     *
+     * \param other Result to compare with
+     *
+     * \return `true` if this result precedes the other one; `false` otherwise
+    */
+    [[nodiscard]]
+    auto operator < (result const& other) const
+        noexcept(noexcept(std::declval<ok_type const&>() < std::declval<ok_type const&>()) &&
+                 noexcept(std::declval<error_type const&>() < std::declval<error_type const&>()))
+        -> bool
+    {
+        if (is_ok() != other.is_ok()) {
+            return is_ok();
+        }
+        if (is_ok()) {
+            return result_detail::access::get<0>(*this) < result_detail::access::get<0>(other);
+        }
+        return result_detail::access::get<1>(*this) < result_detail::access::get<1>(other);
+    }
+
+    /// \copydoc operator<
+    [[nodiscard]]
+    auto operator > (result const& other) const noexcept(noexcept(other < *this)) -> bool
+    {
+        return other < *this;
+    }
+
+    /// \copydoc operator<
+    [[nodiscard]]
+    auto operator <= (result const& other) const noexcept(noexcept(other < *this)) -> bool
+    {
+        return !(other < *this);
+    }
+
+    /// \copydoc operator<
+    [[nodiscard]]
+    auto operator >= (result const& other) const noexcept(noexcept(*this < other)) -> bool
+    {
+        return !(*this < other);
+    }
+#endif
+
+    /**
+     * \brief Extracts the stored value in case of success result and returns it
+     *
+     * \throw bad_result_access
+    */
+    [[nodiscard]]
+    constexpr auto unwrap (RESULT_SITE_PARAM) const& -> ok_type
+    {
+        RESULT_RECORD(is_error(), unwrap_failed);
+        return result_detail::checked_get<0>(*this);
+    }
+
+    /// \copydoc unwrap
+    [[nodiscard]]
+    constexpr auto unwrap (RESULT_SITE_PARAM) && -> ok_type
+    {
+        RESULT_RECORD(is_error(), unwrap_failed);
+        return result_detail::checked_get<0>(std::move(*this));
+    }
+
+    /**
+     * \brief Extracts the stored value in case of failure result and returns it
+     *
+     * \throw bad_result_access
+    */
+    [[nodiscard]]
+    constexpr auto unwrap_error (RESULT_SITE_PARAM) const& -> error_type
+    {
+        RESULT_RECORD(is_ok(), unwrap_failed);
+        return result_detail::checked_get<1>(*this);
+    }
+
+    /// \copydoc unwrap_error
+    [[nodiscard]]
+    constexpr auto unwrap_error (RESULT_SITE_PARAM) && -> error_type
+    {
+        RESULT_RECORD(is_ok(), unwrap_failed);
+        return result_detail::checked_get<1>(std::move(*this));
+    }
+
+    /**
+     * \brief Accesses the stored value of a success result without a state check
+     *
+     * \details Calling it on a failure result is undefined behavior; debug builds assert on it
+    */
+    [[nodiscard]]
+    constexpr auto unwrap_unchecked () const& noexcept -> ok_type const&
+    {
+        RESULT_ASSUME(is_ok());
+        return result_detail::access::get<0>(*this);
+    }
+
+    /// \copydoc unwrap_unchecked
+    [[nodiscard]]
+    constexpr auto unwrap_unchecked () & noexcept -> ok_type&
+    {
+        RESULT_ASSUME(is_ok());
+        return result_detail::access::get<0>(*this);
+    }
+
+    /// \copydoc unwrap_unchecked
+    [[nodiscard]]
+    constexpr auto unwrap_unchecked () && noexcept -> ok_type&&
+    {
+        RESULT_ASSUME(is_ok());
+        return result_detail::access::get<0>(std::move(*this));
+    }
+
+    /**
+     * \brief Accesses the stored value of a failure result without a state check
+     *
+     * \details Calling it on a success result is undefined behavior; debug builds assert on it
+    */
+    [[nodiscard]]
+    constexpr auto unwrap_error_unchecked () const& noexcept -> error_type const&
+    {
+        RESULT_ASSUME(is_error());
+        return result_detail::access::get<1>(*this);
+    }
+
+    /// \copydoc unwrap_error_unchecked
+    [[nodiscard]]
+    constexpr auto unwrap_error_unchecked () & noexcept -> error_type&
+    {
+        RESULT_ASSUME(is_error());
+        return result_detail::access::get<1>(*this);
+    }
+
+    /// \copydoc unwrap_error_unchecked
+    [[nodiscard]]
+    constexpr auto unwrap_error_unchecked () && noexcept -> error_type&&
+    {
+        RESULT_ASSUME(is_error());
+        return result_detail::access::get<1>(std::move(*this));
+    }
+
+    /**
+     * \brief Extracts the stored vavlue in case of success result or a provided default otherwise
+     *
+     * \param def Default value for error case
+    */
+    [[nodiscard]]
+    constexpr auto unwrap_or (ok_type const& def RESULT_SITE_PARAM_NEXT) const -> ok_type
+    {
+        RESULT_RECORD(is_error(), unwrap_fallback);
+        return is_ok() ? result_detail::access::get<0>(*this) : def;
+    }
+
+    /**
+     * \brief Extracts the stored value in case of success result or throws the stored error otherwise
+     *
+     * \details A stored `std::exception_ptr` is rethrown, so the exception keeps its original type.
+     * Any other error value is thrown itself
+     *
+     * \throw error_type or the exception held by the stored `std::exception_ptr`
+    */
+    [[nodiscard]]
+    auto unwrap_or_throw (RESULT_SITE_PARAM) const& -> ok_type
+    {
+        if (is_error()) {
+            RESULT_RECORD(true, unwrap_failed);
+            result_detail::throw_error(result_detail::access::get<1>(*this));
+        }
+        return result_detail::access::get<0>(*this);
+    }
+
+    /// \copydoc unwrap_or_throw
+    [[nodiscard]]
+    auto unwrap_or_throw (RESULT_SITE_PARAM) && -> ok_type
+    {
+        if (is_error()) {
+            RESULT_RECORD(true, unwrap_failed);
+            result_detail::throw_error(result_detail::access::get<1>(std::move(*this)));
+        }
+        return result_detail::access::get<0>(std::move(*this));
+    }
+
+    /**
+     * \brief Performs specified execution in case of success result
+     *
+     * \param func Functor to invoke
+     *
+     * \return Reference to original result object
+    */
+#ifdef RESULT_CONCEPTS
+    template <typename Functor>
+    requires
+             std::invocable<Functor, ok_type> || std::invocable<Functor>
+#else
+    template <typename Functor,
+              typename = std::enable_if_t<std::disjunction_v<std::is_invocable<Functor, ok_type>, std::is_invocable<Functor>>>
+    >
+#endif
+    auto if_ok (Functor&& func) -> result&
+    {
+        if (is_ok()) {
+            if constexpr (std::is_invocable_v<Functor>) {
+                func();
+            }
+            else func(unwrap());
+        }
+        return *this;
+    }
+
+    /**
+     * \brief Performs specified execution in case of failure result
+     *
+     * \param func Functor to invoke
+     *
+     * \return Reference to original result object
+    */
+#ifdef RESULT_CONCEPTS
+    template <typename Functor>
+    requires
+             std::invocable<Functor, error_type> || std::invocable<Functor>
+#else
+    template <typename Functor,
+              typename = std::enable_if_t<std::disjunction_v<std::is_invocable<Functor, error_type>, std::is_invocable<Functor>>>
+    >
+#endif
+    auto if_error (Functor&& func RESULT_SITE_PARAM_NEXT) -> result&
+    {
+        if (is_error()) {
+            RESULT_TRACE(handled, result_detail::access::get<1>(*this));
+
+            if constexpr (std::is_invocable_v<Functor>) {
+                func();
+            }
+            else func(unwrap_error());
+        }
+        return *this;
+    }
+
+    /**
+     * \brief Handles both states at once by invoking one of the specified functors
+     *
+     * \param on_ok Functor to invoke in case of success result
+     * \param on_error Functor to invoke in case of failure result
+     *
+     * \return Value returned by the invoked functor converted to the common type of both
+    */
+#ifdef RESULT_CONCEPTS
+    template <typename On_Ok, typename On_Error>
+    requires
+             (std::invocable<On_Ok, ok_type const&> || std::invocable<On_Ok>) &&
+             (std::invocable<On_Error, error_type const&> || std::invocable<On_Error>)
+#else
+    template <typename On_Ok, typename On_Error,
+              typename = std::enable_if_t<std::conjunction_v<
+                  std::disjunction<std::is_invocable<On_Ok, ok_type const&>, std::is_invocable<On_Ok>>,
+                  std::disjunction<std::is_invocable<On_Error, error_type const&>, std::is_invocable<On_Error>>
+              >>
+    >
+#endif
+    auto match (On_Ok&& on_ok, On_Error&& on_error) const& -> std::common_type_t<
+        result_detail::invoke_optional_t<On_Ok, ok_type const&>,
+        result_detail::invoke_optional_t<On_Error, error_type const&>
+    >
+    {
+        if (is_ok()) {
+            return result_detail::invoke_optional(std::forward<On_Ok>(on_ok), result_detail::access::get<0>(*this));
+        }
+        return result_detail::invoke_optional(std::forward<On_Error>(on_error), result_detail::access::get<1>(*this));
+    }
+
+    /**
+     * \brief Handles both states at once by invoking one of the specified functors with the moved value
+     *
+     * \param on_ok Functor to invoke in case of success result
+     * \param on_error Functor to invoke in case of failure result
+     *
+     * \return Value returned by the invoked functor converted to the common type of both
+    */
+#ifdef RESULT_CONCEPTS
+    template <typename On_Ok, typename On_Error>
+    requires
+             (std::invocable<On_Ok, ok_type&&> || std::invocable<On_Ok>) &&
+             (std::invocable<On_Error, error_type&&> || std::invocable<On_Error>)
+#else
+    template <typename On_Ok, typename On_Error,
+              typename = std::enable_if_t<std::conjunction_v<
+                  std::disjunction<std::is_invocable<On_Ok, ok_type&&>, std::is_invocable<On_Ok>>,
+                  std::disjunction<std::is_invocable<On_Error, error_type&&>, std::is_invocable<On_Error>>
+              >>
+    >
+#endif
+    auto match (On_Ok&& on_ok, On_Error&& on_error) && -> std::common_type_t<
+        result_detail::invoke_optional_t<On_Ok, ok_type&&>,
+        result_detail::invoke_optional_t<On_Error, error_type&&>
+    >
+    {
+        if (is_ok()) {
+            return result_detail::invoke_optional(std::forward<On_Ok>(on_ok), result_detail::access::get<0>(std::move(*this)));
+        }
+        return result_detail::invoke_optional(std::forward<On_Error>(on_error), result_detail::access::get<1>(std::move(*this)));
+    }
+
+private:
+
+    // Converts a result of other value types
+    template <typename Other>
+    static constexpr auto _convert (Other&& other) -> result
+    {
+        if (other.is_ok()) {
+            return result{ std::in_place_index<0>, result_detail::access::get<0>(std::forward<Other>(other)) };
+        }
+        return result{ std::in_place_index<1>, result_detail::access::get<1>(std::forward<Other>(other)) };
+    }
+
+    // Constructs a copy or a conversion of a result, or a value with the allocator
+    template <typename Alloc, typename T>
+    static auto _with_allocator (Alloc const& alloc, T&& other) -> result
+    {
+        using source_type = std::decay_t<T>;
+
+        if constexpr (result_detail::is_result_v<source_type>) {
+            constexpr auto ok_monostate = std::is_same_v<typename source_type::ok_type, result_monostate>;
+            constexpr auto error_monostate = std::is_same_v<typename source_type::error_type, result_monostate>;
+
+            // Single-state results convert like in the converting constructors; others keep their state
+            if constexpr (!std::is_same_v<source_type, result> && ok_monostate != error_monostate) {
+                constexpr auto I = std::size_t{ ok_monostate };
+
+                return result{ std::allocator_arg, alloc, std::in_place_index<I>, result_detail::checked_get<I>(std::forward<T>(other)) };
+            }
+            else if (other.is_ok()) {
+                return result{ std::allocator_arg, alloc, std::in_place_index<0>, result_detail::access::get<0>(std::forward<T>(other)) };
+            }
+            else {
+                return result{ std::allocator_arg, alloc, std::in_place_index<1>, result_detail::access::get<1>(std::forward<T>(other)) };
+            }
+        }
+        else {
+            constexpr auto I = result_detail::select_alternative<T&&, ok_type, error_type>::value;
+
+            return result{ std::allocator_arg, alloc, std::in_place_index<I>, std::forward<T>(other) };
+        }
+    }
+
+};  // end class result
+
+/**
+ * \brief Handles the combined state of several results at once
+ *
+ * \details The last argument is a functor invocable with every combination of the results' payloads:
+ * the stored value of each success result or the stored error of each failure one. All the states are
+ * folded into a single index, so the dispatch is one flat chain of comparisons instead of nested branches
+ *
+ * \param args Results to match followed by the functor to invoke
+ *
+ * \return Value returned by the functor converted to the common type of all combinations
+*/
+template <typename... Args,
+          typename = std::enable_if_t<result_detail::is_match_args<Args...>::value>
+>
+auto match (Args&&... args) -> decltype(auto)
+{
+    auto refs = std::forward_as_tuple(std::forward<Args>(args)...);
+
+    return result_detail::match_forward(
+        std::get<sizeof...(Args) - 1>(std::move(refs)),
+        std::move(refs),
+        std::make_index_sequence<sizeof...(Args) - 1>{}
+    );
+}
+
+namespace result_detail
+{
+    template <typename T>
+    inline constexpr bool is_hashable_v = std::is_default_constructible_v<std::hash<T>>;
+
+    template <typename T>
+    inline constexpr bool is_nothrow_hashable_v = noexcept(std::hash<T>{}(std::declval<T const&>()));
+
+    /// Hasher of an enabled `std::hash` specialization
+    template <typename Ok_t, typename Error_t, bool = is_hashable_v<Ok_t> && is_hashable_v<Error_t>>
+    struct result_hash
+    {
+        [[nodiscard]]
+        auto operator () (result<Ok_t, Error_t> const& res) const
+            noexcept(is_nothrow_hashable_v<Ok_t> && is_nothrow_hashable_v<Error_t>) -> std::size_t
+        {
+            auto const state = std::size_t{ res.is_error() };
+            auto const value = res.is_ok()
+                ? std::hash<Ok_t>{}(access::get<0>(res))
+                : std::hash<Error_t>{}(access::get<1>(res));
+
+            return value ^ (state + static_cast<std::size_t>(0x9e3779b97f4a7c15ull) + (value << 6) + (value >> 2));
+        }
+    };
+
+    /// Disabled `std::hash` specialization for non-hashable values
+    template <typename Ok_t, typename Error_t>
+    struct result_hash<Ok_t, Error_t, false>
+    {
+        result_hash () = delete;
+        result_hash (result_hash const&) = delete;
+        auto operator = (result_hash const&) -> result_hash& = delete;
+    };
+
+}   // end namespace result_detail
+
+/**
+ * \brief Hash support for results
+ *
+ * \details Mixes the state into the hash of the stored value, so a success and
+ * a failure with equal values hash differently. Enabled if both value types are hashable
+*/
+template <typename Ok_t, typename Error_t>
+struct std::hash<result<Ok_t, Error_t>> : result_detail::result_hash<Ok_t, Error_t> {};
+
+/**
+ * \brief Uses-allocator construction support for results
+ *
+ * \details Enabled if any of the value types uses the allocator. Then allocator-aware containers
+ * of results, e.g. `std::pmr::vector`, pass their allocator to the elements
+*/
+template <typename Ok_t, typename Error_t, typename Alloc>
+struct std::uses_allocator<result<Ok_t, Error_t>, Alloc>
+    : std::bool_constant<std::uses_allocator_v<Ok_t, Alloc> || std::uses_allocator_v<Error_t, Alloc>> {};
+
+#endif  // RESULT_H
+
+// MIT License
+//
+// Copyright (c) 2021 Alex Qzminsky
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
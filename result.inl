@@ -1,65 +1,98 @@
-#pragma once
-
-// Copyright © 2021 Alex Qzminsky.
-// License: MIT. All rights reserved.
-
-/// \brief Result variant type: simple constructors extension
-///
-/// \author https://github.com/qzminsky
-/// \version 0.1.0
-/// \date 2021/01/06
-
-#ifndef RESULT_INL
-#define RESULT_INL
-
-static_assert(__cplusplus >= 2017'00, "C++17 or higher is required");
-
-#include "result.hpp"
-
-/**
- * \brief Constructs a success result object with specified value
- *
- * \param val Success value stored in result
-*/
-template <typename T>
-[[nodiscard]]
-inline auto Ok (T const& val)
-{
-    return result<>::ok(val);
-}
-
-/**
- * \brief Constructs a failure result object with specified value
- *
- * \param val Failure value stored in result
-*/
-template <typename T>
-[[nodiscard]]
-inline auto Error (T const& val)
-{
-    return result<>::error(val);
-}
-
-#endif  // RESULT_INL
-
-// MIT License
-//
-// Copyright (c) 2021 Alex Qzminsky
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files (the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions:
-//
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
+#pragma once
+
+// Copyright © 2021 Alex Qzminsky.
+// License: MIT. All rights reserved.
+
+/// \brief Result variant type: simple constructors extension
+///
+/// \author https://github.com/qzminsky
+/// \version 0.1.0
+/// \date 2021/01/06
+
+#ifndef RESULT_INL
+#define RESULT_INL
+
+static_assert(__cplusplus >= 2017'00, "C++17 or higher is required");
+
+#include "result.hpp"
+
+/**
+ * \brief Constructs a success result object with specified value
+ *
+ * \param val Success value stored in result
+*/
+template <typename T>
+[[nodiscard]]
+inline auto Ok (T&& val)
+{
+    return result<>::ok(std::forward<T>(val));
+}
+
+/**
+ * \brief Constructs a failure result object with specified value
+ *
+ * \param val Failure value stored in result
+*/
+template <typename T>
+[[nodiscard]]
+inline auto Error (T&& val RESULT_SITE_PARAM_NEXT)
+{
+    return result<>::error(std::forward<T>(val) RESULT_SITE_ARG_NEXT);
+}
+
+namespace result_detail
+{
+    /// Converts the failure result to be returned by `RESULT_TRY`
+    template <typename Result>
+    auto propagate (Result&& res RESULT_SITE_PARAM_NEXT) -> result<result_monostate, typename std::decay_t<Result>::error_type>
+    {
+        RESULT_TRACE(propagated, access::get<1>(res));
+
+        return result<result_monostate, typename std::decay_t<Result>::error_type>{
+            std::in_place_index<1>, access::get<1>(std::forward<Result>(res))
+        };
+    }
+
+}   // end namespace result_detail
+
+#define RESULT_TRY_CONCAT_IMPL(a, b) a##b
+#define RESULT_TRY_CONCAT(a, b) RESULT_TRY_CONCAT_IMPL(a, b)
+
+/**
+ * \brief Declares `name` bound to the success value of the result expression, or returns
+ * its error from the enclosing function
+ *
+ * \details The enclosing function must return a result with a compatible error type
+*/
+#define RESULT_TRY(name, ...) RESULT_TRY_IMPL(name, RESULT_TRY_CONCAT(result_try_, __COUNTER__), __VA_ARGS__)
+
+#define RESULT_TRY_IMPL(name, tmp, ...) \
+    auto&& tmp = (__VA_ARGS__); \
+    if (tmp.is_error()) { \
+        return result_detail::propagate(std::forward<decltype(tmp)>(tmp)); \
+    } \
+    auto&& name = std::forward<decltype(tmp)>(tmp).unwrap_unchecked()
+
+#endif  // RESULT_INL
+
+// MIT License
+//
+// Copyright (c) 2021 Alex Qzminsky
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
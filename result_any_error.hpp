@@ -0,0 +1,350 @@
+#pragma once
+
+// Copyright © 2021 Alex Qzminsky.
+// License: MIT. All rights reserved.
+
+/// \brief Result variant type: type-erased error extension
+///
+/// \author https://github.com/qzminsky
+/// \version 0.1.0
+/// \date 2026/10/16
+
+#ifndef RESULT_ANY_ERROR_H
+#define RESULT_ANY_ERROR_H
+
+static_assert(__cplusplus >= 2017'00, "C++17 or higher is required");
+
+#include "result.hpp"
+
+#include <cstddef>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+class any_error;
+
+namespace result_detail
+{
+    /// Storage of a type-erased error: the error itself if it's small, its address otherwise
+    union any_error_storage
+    {
+        static constexpr std::size_t capacity = 32;
+
+        alignas(std::max_align_t) unsigned char buffer[capacity];
+        void* heap;
+    };
+
+    /// Operations on a type-erased error
+    struct any_error_vtable
+    {
+        auto (*destroy) (any_error_storage& self) noexcept -> void;
+        auto (*move) (any_error_storage& from, any_error_storage& to) noexcept -> void;
+        auto (*copy) (any_error_storage const& from, any_error_storage& to) -> void;
+        auto (*message) (any_error_storage const& self) -> std::string;
+    };
+
+    /// Checks if the type is an in-place type tag
+    template <typename T>
+    struct is_in_place_type : std::false_type {};
+
+    template <typename T>
+    struct is_in_place_type<std::in_place_type_t<T>> : std::true_type {};
+
+    /// Checks if the error is stored in the buffer
+    template <typename Error_t>
+    inline constexpr bool is_inline_error_v =
+        sizeof(Error_t) <= any_error_storage::capacity &&
+        alignof(Error_t) <= alignof(std::max_align_t) &&
+        std::is_nothrow_move_constructible_v<Error_t>;
+
+    template <typename T, typename = void>
+    struct has_message : std::false_type {};
+
+    template <typename T>
+    struct has_message<T, std::void_t<decltype(std::string(std::declval<T const&>().message()))>> : std::true_type {};
+
+    template <typename T, typename = void>
+    struct has_what : std::false_type {};
+
+    template <typename T>
+    struct has_what<T, std::void_t<decltype(std::string(std::declval<T const&>().what()))>> : std::true_type {};
+
+    template <typename T, typename = void>
+    struct has_to_string : std::false_type {};
+
+    template <typename T>
+    struct has_to_string<T, std::void_t<decltype(to_string(std::declval<T const&>()))>> : std::true_type {};
+
+    /// Describes an error: its `message()`, `what()`, text, number, or `to_string` found by ADL
+    template <typename Error_t>
+    auto describe (Error_t const& err) -> std::string
+    {
+        using std::to_string;
+
+        if constexpr (has_message<Error_t>::value) {
+            return std::string(err.message());
+        }
+        else if constexpr (has_what<Error_t>::value) {
+            return std::string(err.what());
+        }
+        else if constexpr (std::is_constructible_v<std::string, Error_t const&>) {
+            return std::string(err);
+        }
+        else if constexpr (std::is_arithmetic_v<Error_t>) {
+            return std::to_string(err);
+        }
+        else if constexpr (std::is_enum_v<Error_t> && !has_to_string<Error_t>::value) {
+            return to_string(static_cast<std::underlying_type_t<Error_t>>(err));
+        }
+        else if constexpr (has_to_string<Error_t>::value) {
+            return to_string(err);
+        }
+        else return "unknown error";
+    }
+
+    /// Operations on an error of the specified type
+    template <typename Error_t>
+    struct any_error_ops
+    {
+        static auto get (any_error_storage& self) noexcept -> Error_t*
+        {
+            if constexpr (is_inline_error_v<Error_t>) {
+                return std::launder(reinterpret_cast<Error_t*>(self.buffer));
+            }
+            else return static_cast<Error_t*>(self.heap);
+        }
+
+        static auto get (any_error_storage const& self) noexcept -> Error_t const*
+        {
+            return get(const_cast<any_error_storage&>(self));
+        }
+
+        template <typename... Args>
+        static auto construct (any_error_storage& self, Args&&... args) -> void
+        {
+            if constexpr (is_inline_error_v<Error_t>) {
+                ::new (static_cast<void*>(self.buffer)) Error_t(std::forward<Args>(args)...);
+            }
+            else self.heap = new Error_t(std::forward<Args>(args)...);
+        }
+
+        static auto destroy (any_error_storage& self) noexcept -> void
+        {
+            if constexpr (is_inline_error_v<Error_t>) {
+                get(self)->~Error_t();
+            }
+            else delete get(self);
+        }
+
+        static auto move (any_error_storage& from, any_error_storage& to) noexcept -> void
+        {
+            if constexpr (is_inline_error_v<Error_t>) {
+                ::new (static_cast<void*>(to.buffer)) Error_t(std::move(*get(from)));
+                get(from)->~Error_t();
+            }
+            else to.heap = from.heap;
+        }
+
+        static auto copy (any_error_storage const& from, any_error_storage& to) -> void
+        {
+            construct(to, *get(from));
+        }
+
+        static auto message (any_error_storage const& self) -> std::string
+        {
+            return describe(*get(self));
+        }
+    };
+
+    /// Virtual table of the specified error type; its address identifies the type
+    template <typename Error_t>
+    inline constexpr any_error_vtable any_error_vtable_of = {
+        &any_error_ops<Error_t>::destroy,
+        &any_error_ops<Error_t>::move,
+        &any_error_ops<Error_t>::copy,
+        &any_error_ops<Error_t>::message
+    };
+
+}   // end namespace result_detail
+
+/**
+ * \class any_error
+ *
+ * \brief Error of any copyable type
+ *
+ * \details Errors of up to 32 bytes that are nothrow movable are stored inline, so wrapping them
+ * doesn't allocate; larger ones are allocated on the heap. The type is identified by the address
+ * of a static virtual table, so `is` and `as` compile to a pointer comparison. Across shared
+ * libraries, the addresses are unique only if the virtual tables are exported, as they are on ELF
+ * platforms with the default visibility
+*/
+class any_error
+{
+public:
+
+    /// Size of the inline storage
+    static constexpr std::size_t inline_capacity = result_detail::any_error_storage::capacity;
+
+private:
+
+    result_detail::any_error_storage _storage;
+    result_detail::any_error_vtable const* _vtable;
+
+public:
+
+    /**
+     * \brief Wraps an error
+     *
+     * \details Only copyable errors are accepted. Arrays aren't: a string literal would be kept as
+     * a pointer, and in `result<std::string, any_error>` it's meant to be the value
+     *
+     * \param err Error value to copy or move
+    */
+    template <typename Error_t,
+              typename = std::enable_if_t<!std::is_same_v<std::decay_t<Error_t>, any_error> &&
+                                          !result_detail::is_in_place_type<std::decay_t<Error_t>>::value &&
+                                          !std::is_array_v<std::remove_reference_t<Error_t>> &&
+                                          std::is_copy_constructible_v<std::decay_t<Error_t>>>
+    >
+    any_error (Error_t&& err) : any_error{ std::in_place_type<std::decay_t<Error_t>>, std::forward<Error_t>(err) } {}
+
+    /**
+     * \brief Constructs an error of the specified type in place
+     *
+     * \param args Arguments to construct the error from
+    */
+    template <typename Error_t, typename... Args>
+    explicit any_error (std::in_place_type_t<Error_t>, Args&&... args)
+        : _vtable{ &result_detail::any_error_vtable_of<Error_t> }
+    {
+        static_assert(std::is_copy_constructible_v<Error_t>, "The error type must be copyable");
+
+        result_detail::any_error_ops<Error_t>::construct(_storage, std::forward<Args>(args)...);
+    }
+
+    any_error (any_error const& other) : _vtable{ other._vtable }
+    {
+        if (_vtable) _vtable->copy(other._storage, _storage);
+    }
+
+    /// Move constructor; the moved-from error is left empty
+    any_error (any_error&& other) noexcept : _vtable{ std::exchange(other._vtable, nullptr) }
+    {
+        if (_vtable) _vtable->move(other._storage, _storage);
+    }
+
+    auto operator = (any_error const& other) -> any_error&
+    {
+        if (this != &other) {
+            *this = any_error{ other };
+        }
+        return *this;
+    }
+
+    auto operator = (any_error&& other) noexcept -> any_error&
+    {
+        if (this != &other) {
+            _reset();
+            _vtable = std::exchange(other._vtable, nullptr);
+
+            if (_vtable) _vtable->move(other._storage, _storage);
+        }
+        return *this;
+    }
+
+    ~any_error ()
+    {
+        _reset();
+    }
+
+    /**
+     * \brief Returns `false` if the error was moved from
+    */
+    [[nodiscard]]
+    auto has_value () const noexcept -> bool
+    {
+        return _vtable != nullptr;
+    }
+
+    /**
+     * \brief Checks if the stored error has the specified type
+    */
+    template <typename Error_t>
+    [[nodiscard]]
+    auto is () const noexcept -> bool
+    {
+        return _vtable == &result_detail::any_error_vtable_of<Error_t>;
+    }
+
+    /**
+     * \brief Returns the stored error of the specified type, or `nullptr` if it's of another type
+    */
+    template <typename Error_t>
+    [[nodiscard]]
+    auto as () noexcept -> Error_t*
+    {
+        return is<Error_t>() ? result_detail::any_error_ops<Error_t>::get(_storage) : nullptr;
+    }
+
+    /// \copydoc as
+    template <typename Error_t>
+    [[nodiscard]]
+    auto as () const noexcept -> Error_t const*
+    {
+        return is<Error_t>() ? result_detail::any_error_ops<Error_t>::get(_storage) : nullptr;
+    }
+
+    /**
+     * \brief Describes the error: its `message()`, `what()`, text, or `to_string` found by ADL
+    */
+    [[nodiscard]]
+    auto message () const -> std::string
+    {
+        return _vtable ? _vtable->message(_storage) : std::string{ "empty error" };
+    }
+
+    /**
+     * \brief Returns the identifier of the stored error type; equal for equal types
+    */
+    [[nodiscard]]
+    auto type_id () const noexcept -> void const*
+    {
+        return _vtable;
+    }
+
+private:
+
+    auto _reset () noexcept -> void
+    {
+        if (_vtable) {
+            _vtable->destroy(_storage);
+            _vtable = nullptr;
+        }
+    }
+
+};  // end class any_error
+
+#endif  // RESULT_ANY_ERROR_H
+
+// MIT License
+//
+// Copyright (c) 2021 Alex Qzminsky
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
@@ -0,0 +1,225 @@
+#pragma once
+
+// Copyright © 2021 Alex Qzminsky.
+// License: MIT. All rights reserved.
+
+/// \brief Result variant type: publish-once atomic cell
+///
+/// \author https://github.com/qzminsky
+/// \version 0.1.0
+/// \date 2026/10/16
+
+#ifndef RESULT_ATOMIC_H
+#define RESULT_ATOMIC_H
+
+static_assert(__cplusplus >= 2020'00, "C++20 or higher is required for the atomic cell");
+
+#include "result.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <thread>
+
+/**
+ * \class atomic_result
+ *
+ * \brief Result published once by one thread and read by many
+ *
+ * \details The cell is empty until `set` succeeds; the result is immutable afterwards. Readers
+ * check a single state word with an acquire load, so reading a published result never takes
+ * a lock. `wait` sleeps in `std::atomic::wait` on the state word, and `set` issues the
+ * notification only if a reader is asleep
+*/
+template <typename Ok_t, typename Error_t>
+class atomic_result
+{
+public:
+
+    // ANCHOR Member types
+    using result_type = result<Ok_t, Error_t>;
+
+private:
+
+    // Publication states; `sleeping` is added to `empty` or `writing` by the waiting readers
+    enum : std::uint32_t
+    {
+        empty    = 0,
+        writing  = 1,
+        ready    = 2,
+        sleeping = 4
+    };
+
+    // Mutable, since waiting readers set the `sleeping` flag
+    mutable std::atomic<std::uint32_t> _state{ empty };
+    alignas(result_type) unsigned char _value[sizeof(result_type)];
+
+public:
+
+    /**
+     * \brief Constructs an empty cell
+    */
+    atomic_result () noexcept = default;
+
+    atomic_result (atomic_result const&) = delete;
+    auto operator = (atomic_result const&) -> atomic_result& = delete;
+
+    ~atomic_result ()
+    {
+        if (_state.load(std::memory_order_acquire) & ready) {
+            _get()->~result_type();
+        }
+    }
+
+    /**
+     * \brief Publishes the result unless another one is published or being published
+     *
+     * \param args Result or arguments to construct it, e.g. `result<>::ok(val)` or `Error(err)`
+     *
+     * \return `true` if this call published the result
+    */
+    template <typename... Args>
+    auto set (Args&&... args) -> bool
+    {
+        auto expected = std::uint32_t{ empty };
+
+        while (!_state.compare_exchange_weak(expected, expected | writing, std::memory_order_acquire, std::memory_order_relaxed)) {
+            if (expected & (writing | ready)) return false;
+        }
+
+        try {
+            ::new (static_cast<void*>(_value)) result_type(std::forward<Args>(args)...);
+        }
+        catch (...) {
+            _state.fetch_and(~std::uint32_t{ writing }, std::memory_order_release);
+            throw;
+        }
+
+        if (_state.exchange(ready, std::memory_order_release) & sleeping) {
+            _state.notify_all();
+        }
+        return true;
+    }
+
+    /**
+     * \brief Returns `true` if the result is published
+    */
+    [[nodiscard]]
+    auto is_ready () const noexcept -> bool
+    {
+        return _state.load(std::memory_order_acquire) == ready;
+    }
+
+    /**
+     * \brief Returns the published result, or `nullptr` if there is none yet
+    */
+    [[nodiscard]]
+    auto try_get () const noexcept -> result_type const*
+    {
+        return is_ready() ? _get() : nullptr;
+    }
+
+    /**
+     * \brief Waits until the result is published
+     *
+     * \return Published result; it lives as long as the cell
+    */
+    auto wait () const noexcept -> result_type const&
+    {
+        auto state = _state.load(std::memory_order_acquire);
+
+        while (state != ready) {
+            if (!(state & sleeping)) {
+                // A failed CAS reloads the state and the check is repeated
+                if (!_state.compare_exchange_weak(state, state | sleeping, std::memory_order_relaxed)) continue;
+                state |= sleeping;
+            }
+            _state.wait(state, std::memory_order_acquire);
+            state = _state.load(std::memory_order_acquire);
+        }
+        return *_get();
+    }
+
+    /**
+     * \brief Waits until the result is published or the time point is reached
+     *
+     * \details `std::atomic::wait` has no timed form, so the thread polls the state with
+     * a growing pause that never ends after the deadline
+     *
+     * \param deadline Time point to give up at
+     *
+     * \return Published result, or `nullptr` on timeout
+    */
+    template <typename Clock, typename Duration>
+    auto wait_until (std::chrono::time_point<Clock, Duration> const& deadline) const -> result_type const*
+    {
+        auto pause = std::chrono::microseconds{ 1 };
+
+        for (auto spins = 0; !is_ready(); ++spins) {
+            auto const now = Clock::now();
+
+            if (now >= deadline) {
+                return try_get();
+            }
+            if (spins < 64) {
+                std::this_thread::yield();
+                continue;
+            }
+            // The remaining time is rounded up to the clock ticks, so a floating or finer deadline fits too
+            std::this_thread::sleep_for(std::min<typename Clock::duration>(
+                std::chrono::duration_cast<typename Clock::duration>(pause),
+                std::chrono::ceil<typename Clock::duration>(deadline - now)
+            ));
+            pause = std::min(pause * 2, std::chrono::microseconds{ 1000 });
+        }
+        return _get();
+    }
+
+    /**
+     * \brief Waits until the result is published or the timeout expires
+     *
+     * \param timeout Maximal waiting time
+     *
+     * \return Published result, or `nullptr` on timeout
+    */
+    template <typename Rep, typename Period>
+    auto wait_for (std::chrono::duration<Rep, Period> const& timeout) const -> result_type const*
+    {
+        return wait_until(std::chrono::steady_clock::now() + timeout);
+    }
+
+private:
+
+    auto _get () const noexcept -> result_type const*
+    {
+        return std::launder(reinterpret_cast<result_type const*>(_value));
+    }
+
+};  // end class atomic_result
+
+#endif  // RESULT_ATOMIC_H
+
+// MIT License
+//
+// Copyright (c) 2021 Alex Qzminsky
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
@@ -0,0 +1,472 @@
+// Copyright © 2021 Alex Qzminsky.
+// License: MIT. All rights reserved.
+
+/// \brief Result variant type: micro-benchmarks
+///
+/// \details Compares the result with exceptions, integer error codes, `std::optional` and
+/// `std::expected` (if available). Each line of the output is a JSON object:
+///
+///     {"bench": "propagate", "impl": "result", "frames": 8, "error_rate": 0.01, "ns_per_op": 3.1}
+///
+/// Build and run:
+///
+///     g++ -std=c++23 -O2 result_bench.cpp -o result_bench && ./result_bench > bench_output.txt
+///
+/// \author https://github.com/qzminsky
+/// \version 0.1.0
+/// \date 2026/10/16
+
+#include "result.inl"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+#if __has_include(<expected>)
+#   include <expected>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#   define BENCH_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+#   define BENCH_NOINLINE __declspec(noinline)
+#else
+#   define BENCH_NOINLINE
+#endif
+
+namespace
+{
+    /// Keeps the compiler from optimizing the value away
+    template <typename T>
+    inline auto keep (T const& val) -> void
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile ("" : : "g"(&val) : "memory");
+#else
+        static T const* volatile sink = nullptr;
+        sink = &val;
+#endif
+    }
+
+    /// Failure pattern with the specified share of failures
+    auto make_pattern (double error_rate) -> std::vector<bool>
+    {
+        auto pattern = std::vector<bool>(4096);
+        auto seed = std::uint32_t{ 12345 };
+
+        for (auto&& fail : pattern) {
+            seed = seed * 1664525u + 1013904223u;
+            fail = (seed >> 8) < static_cast<std::uint32_t>(error_rate * double(1u << 24));
+        }
+        return pattern;
+    }
+
+    /// Returns the best time per operation of several runs in nanoseconds
+    template <typename Body>
+    auto measure (Body&& body) -> double
+    {
+        using clock = std::chrono::steady_clock;
+
+        constexpr auto batch = std::size_t{ 1 } << 16;
+        auto best = 1e300;
+
+        for (auto run = 0; run < 5; ++run) {
+            auto const start = clock::now();
+
+            for (auto i = std::size_t{ 0 }; i < batch; ++i) {
+                body(i);
+            }
+            auto const elapsed = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+
+            best = std::min(best, elapsed / batch);
+        }
+        return best;
+    }
+
+    auto report (char const* bench, char const* impl, int frames, double error_rate, double ns) -> void
+    {
+        std::printf(
+            "{\"bench\": \"%s\", \"impl\": \"%s\", \"frames\": %d, \"error_rate\": %g, \"ns_per_op\": %.3f}\n",
+            bench, impl, frames, error_rate, ns
+        );
+    }
+
+    // ANCHOR Propagation through nested frames
+
+    constexpr auto frames = 8;
+
+    struct bench_error : std::runtime_error
+    {
+        int code;
+        explicit bench_error (int c) : std::runtime_error{ "bench" }, code{ c } {}
+    };
+
+    BENCH_NOINLINE auto result_leaf (int x, bool fail) -> result<int, int>
+    {
+        if (fail) return Error(x);
+        return Ok(x);
+    }
+
+    template <int N>
+    BENCH_NOINLINE auto result_frame (int x, bool fail) -> result<int, int>
+    {
+        if constexpr (N == 0) {
+            return result_leaf(x, fail);
+        }
+        else {
+            auto res = result_frame<N - 1>(x, fail);
+            if (res.is_error()) return res;
+
+            return Ok(res.unwrap() + 1);
+        }
+    }
+
+    BENCH_NOINLINE auto exception_leaf (int x, bool fail) -> int
+    {
+        if (fail) throw bench_error{ x };
+        return x;
+    }
+
+    template <int N>
+    BENCH_NOINLINE auto exception_frame (int x, bool fail) -> int
+    {
+        if constexpr (N == 0) {
+            return exception_leaf(x, fail);
+        }
+        else return exception_frame<N - 1>(x, fail) + 1;
+    }
+
+    BENCH_NOINLINE auto code_leaf (int x, bool fail, int& out) -> int
+    {
+        if (fail) return x | 1;
+        out = x;
+        return 0;
+    }
+
+    template <int N>
+    BENCH_NOINLINE auto code_frame (int x, bool fail, int& out) -> int
+    {
+        if constexpr (N == 0) {
+            return code_leaf(x, fail, out);
+        }
+        else {
+            if (auto const code = code_frame<N - 1>(x, fail, out); code != 0) return code;
+
+            out += 1;
+            return 0;
+        }
+    }
+
+    BENCH_NOINLINE auto optional_leaf (int x, bool fail) -> std::optional<int>
+    {
+        if (fail) return std::nullopt;
+        return x;
+    }
+
+    template <int N>
+    BENCH_NOINLINE auto optional_frame (int x, bool fail) -> std::optional<int>
+    {
+        if constexpr (N == 0) {
+            return optional_leaf(x, fail);
+        }
+        else {
+            auto res = optional_frame<N - 1>(x, fail);
+            if (!res) return res;
+
+            return *res + 1;
+        }
+    }
+
+#ifdef __cpp_lib_expected
+    BENCH_NOINLINE auto expected_leaf (int x, bool fail) -> std::expected<int, int>
+    {
+        if (fail) return std::unexpected(x);
+        return x;
+    }
+
+    template <int N>
+    BENCH_NOINLINE auto expected_frame (int x, bool fail) -> std::expected<int, int>
+    {
+        if constexpr (N == 0) {
+            return expected_leaf(x, fail);
+        }
+        else {
+            auto res = expected_frame<N - 1>(x, fail);
+            if (!res) return res;
+
+            return *res + 1;
+        }
+    }
+#endif
+
+    auto bench_propagation (double error_rate) -> void
+    {
+        auto const pattern = make_pattern(error_rate);
+        auto const mask = pattern.size() - 1;
+
+        report("propagate", "result", frames, error_rate, measure([&](std::size_t i) {
+            keep(result_frame<frames>(int(i), pattern[i & mask]));
+        }));
+
+        report("propagate", "exception", frames, error_rate, measure([&](std::size_t i) {
+            try {
+                keep(exception_frame<frames>(int(i), pattern[i & mask]));
+            }
+            catch (bench_error const& e) {
+                keep(e.code);
+            }
+        }));
+
+        report("propagate", "error_code", frames, error_rate, measure([&](std::size_t i) {
+            auto out = 0;
+            keep(code_frame<frames>(int(i), pattern[i & mask], out));
+            keep(out);
+        }));
+
+        report("propagate", "optional", frames, error_rate, measure([&](std::size_t i) {
+            keep(optional_frame<frames>(int(i), pattern[i & mask]));
+        }));
+
+#ifdef __cpp_lib_expected
+        report("propagate", "expected", frames, error_rate, measure([&](std::size_t i) {
+            keep(expected_frame<frames>(int(i), pattern[i & mask]));
+        }));
+#endif
+    }
+
+    // ANCHOR Basic operations
+
+    auto bench_operations () -> void
+    {
+        auto const pattern = make_pattern(0.5);
+        auto const mask = pattern.size() - 1;
+
+        // Construction of a success value
+
+        report("construct", "result", 0, 0.0, measure([&](std::size_t i) {
+            auto res = result<int, int>{ Ok(int(i)) };
+            keep(res);
+        }));
+
+        report("construct", "exception", 0, 0.0, measure([&](std::size_t i) {
+            auto val = int(i);
+            keep(val);
+        }));
+
+        report("construct", "error_code", 0, 0.0, measure([&](std::size_t i) {
+            auto code = 0, out = int(i);
+            keep(code);
+            keep(out);
+        }));
+
+        report("construct", "optional", 0, 0.0, measure([&](std::size_t i) {
+            auto res = std::optional<int>{ int(i) };
+            keep(res);
+        }));
+
+#ifdef __cpp_lib_expected
+        report("construct", "expected", 0, 0.0, measure([&](std::size_t i) {
+            auto res = std::expected<int, int>{ int(i) };
+            keep(res);
+        }));
+#endif
+
+        // Return of a success from a call
+
+        report("return_ok", "result", 1, 0.0, measure([&](std::size_t i) {
+            keep(result_leaf(int(i), false));
+        }));
+
+        report("return_ok", "exception", 1, 0.0, measure([&](std::size_t i) {
+            keep(exception_leaf(int(i), false));
+        }));
+
+        report("return_ok", "error_code", 1, 0.0, measure([&](std::size_t i) {
+            auto out = 0;
+            keep(code_leaf(int(i), false, out));
+            keep(out);
+        }));
+
+        report("return_ok", "optional", 1, 0.0, measure([&](std::size_t i) {
+            keep(optional_leaf(int(i), false));
+        }));
+
+#ifdef __cpp_lib_expected
+        report("return_ok", "expected", 1, 0.0, measure([&](std::size_t i) {
+            keep(expected_leaf(int(i), false));
+        }));
+#endif
+
+        // Return of a failure from a call
+
+        report("return_error", "result", 1, 1.0, measure([&](std::size_t i) {
+            keep(result_leaf(int(i), true));
+        }));
+
+        report("return_error", "exception", 1, 1.0, measure([&](std::size_t i) {
+            try {
+                keep(exception_leaf(int(i), true));
+            }
+            catch (bench_error const& e) {
+                keep(e.code);
+            }
+        }));
+
+        report("return_error", "error_code", 1, 1.0, measure([&](std::size_t i) {
+            auto out = 0;
+            keep(code_leaf(int(i), true, out));
+        }));
+
+        report("return_error", "optional", 1, 1.0, measure([&](std::size_t i) {
+            keep(optional_leaf(int(i), true));
+        }));
+
+#ifdef __cpp_lib_expected
+        report("return_error", "expected", 1, 1.0, measure([&](std::size_t i) {
+            keep(expected_leaf(int(i), true));
+        }));
+#endif
+
+        // Checked access to the success value
+
+        report("unwrap", "result", 1, 0.0, measure([&](std::size_t i) {
+            keep(result_leaf(int(i), false).unwrap());
+        }));
+
+        report("unwrap", "exception", 1, 0.0, measure([&](std::size_t i) {
+            keep(exception_leaf(int(i), false));
+        }));
+
+        report("unwrap", "error_code", 1, 0.0, measure([&](std::size_t i) {
+            auto out = 0;
+
+            if (code_leaf(int(i), false, out) != 0) throw bench_error{ out };
+            keep(out);
+        }));
+
+        report("unwrap", "optional", 1, 0.0, measure([&](std::size_t i) {
+            keep(optional_leaf(int(i), false).value());
+        }));
+
+#ifdef __cpp_lib_expected
+        report("unwrap", "expected", 1, 0.0, measure([&](std::size_t i) {
+            keep(expected_leaf(int(i), false).value());
+        }));
+#endif
+
+        // Access with a fallback value
+
+        report("unwrap_or", "result", 1, 0.5, measure([&](std::size_t i) {
+            keep(result_leaf(int(i), pattern[i & mask]).unwrap_or(-1));
+        }));
+
+        report("unwrap_or", "exception", 1, 0.5, measure([&](std::size_t i) {
+            auto val = -1;
+
+            try {
+                val = exception_leaf(int(i), pattern[i & mask]);
+            }
+            catch (bench_error const&) {}
+            keep(val);
+        }));
+
+        report("unwrap_or", "error_code", 1, 0.5, measure([&](std::size_t i) {
+            auto out = 0;
+            keep(code_leaf(int(i), pattern[i & mask], out) != 0 ? -1 : out);
+        }));
+
+        report("unwrap_or", "optional", 1, 0.5, measure([&](std::size_t i) {
+            keep(optional_leaf(int(i), pattern[i & mask]).value_or(-1));
+        }));
+
+#ifdef __cpp_lib_expected
+        report("unwrap_or", "expected", 1, 0.5, measure([&](std::size_t i) {
+            keep(expected_leaf(int(i), pattern[i & mask]).value_or(-1));
+        }));
+#endif
+
+        // Handling of both states
+
+        report("if_ok_chain", "result", 1, 0.5, measure([&](std::size_t i) {
+            auto sum = 0;
+            result_leaf(int(i), pattern[i & mask])
+                .if_ok([&](int val) { sum += val; })
+                .if_error([&](int err) { sum -= err; });
+            keep(sum);
+        }));
+
+        report("if_ok_chain", "exception", 1, 0.5, measure([&](std::size_t i) {
+            auto sum = 0;
+
+            try {
+                sum += exception_leaf(int(i), pattern[i & mask]);
+            }
+            catch (bench_error const& e) {
+                sum -= e.code;
+            }
+            keep(sum);
+        }));
+
+        report("if_ok_chain", "error_code", 1, 0.5, measure([&](std::size_t i) {
+            auto sum = 0, out = 0;
+
+            if (auto const code = code_leaf(int(i), pattern[i & mask], out); code != 0) sum -= code;
+            else sum += out;
+            keep(sum);
+        }));
+
+        report("if_ok_chain", "optional", 1, 0.5, measure([&](std::size_t i) {
+            auto sum = 0;
+
+            if (auto const res = optional_leaf(int(i), pattern[i & mask])) sum += *res;
+            else sum -= 1;
+            keep(sum);
+        }));
+
+#ifdef __cpp_lib_expected
+        report("if_ok_chain", "expected", 1, 0.5, measure([&](std::size_t i) {
+            auto sum = 0;
+
+            if (auto const res = expected_leaf(int(i), pattern[i & mask])) sum += *res;
+            else sum -= res.error();
+            keep(sum);
+        }));
+#endif
+    }
+
+}   // end anonymous namespace
+
+auto main () -> int
+{
+    bench_operations();
+
+    for (auto const error_rate : { 0.0, 0.01, 0.1, 0.5 }) {
+        bench_propagation(error_rate);
+    }
+}
+
+// MIT License
+//
+// Copyright (c) 2021 Alex Qzminsky
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
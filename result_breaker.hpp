@@ -0,0 +1,359 @@
+#pragma once
+
+// Copyright © 2021 Alex Qzminsky.
+// License: MIT. All rights reserved.
+
+/// \brief Result variant type: circuit breaker extension
+///
+/// \author https://github.com/qzminsky
+/// \version 0.1.0
+/// \date 2026/10/16
+
+#ifndef RESULT_BREAKER_H
+#define RESULT_BREAKER_H
+
+static_assert(__cplusplus >= 2017'00, "C++17 or higher is required");
+
+#include "result.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
+/**
+ * \brief Circuit breaker options
+*/
+struct breaker_options
+{
+    using clock_type = std::chrono::steady_clock;
+
+    /// Share of failures in the window that opens the circuit
+    double failure_ratio = 0.5;
+
+    /// Minimal number of calls in the window to judge the failure ratio
+    std::uint32_t min_calls = 20;
+
+    /// Length of the sliding window of calls statistics
+    clock_type::duration window = std::chrono::seconds{ 10 };
+
+    /// Time the circuit stays open before probing the dependency again
+    clock_type::duration cooldown = std::chrono::seconds{ 5 };
+
+    /// Maximal number of concurrent probe calls in the half-open state
+    std::uint32_t probes = 1;
+};
+
+/**
+ * \brief State of a circuit breaker
+*/
+enum class breaker_state : std::uint8_t
+{
+    closed,     ///< Calls pass through and are counted
+    open,       ///< Calls are short-circuited to the configured error
+    half_open   ///< A limited number of probe calls decide whether to close the circuit
+};
+
+/**
+ * \class circuit_breaker
+ *
+ * \brief Sheds load from a degraded dependency by the failure rate of its results
+ *
+ * \details Counts success and failure results in a sliding window of time slices. The counters
+ * are relaxed atomics striped across threads, so a call never takes a lock; slices are reset
+ * lazily on reuse, which makes the statistics approximate at slice boundaries. When the failure
+ * ratio exceeds the threshold, the circuit opens and calls return the configured error without
+ * invoking the dependency. After the cooldown, a few probe calls are let through: a success
+ * closes the circuit, a failure opens it again
+*/
+template <typename Error_t>
+class circuit_breaker
+{
+public:
+
+    // ANCHOR Member types
+    using error_type = Error_t;
+    using clock_type = breaker_options::clock_type;
+
+private:
+
+    static constexpr std::size_t slices  = 10;
+    static constexpr std::size_t stripes = 16;
+
+    // Counters of one thread stripe, padded to its own cache line
+    struct alignas(64) stripe
+    {
+        std::atomic<std::uint32_t> ok{ 0 };
+        std::atomic<std::uint32_t> failed{ 0 };
+    };
+
+    // Counters of one time slice of the window
+    struct slice
+    {
+        std::atomic<std::int64_t> epoch{ -1 };
+        stripe counters[stripes];
+    };
+
+    error_type _open_error;
+    breaker_options _options;
+
+    slice _slices[slices];
+
+    alignas(64) std::atomic<breaker_state> _state{ breaker_state::closed };
+    std::atomic<std::int64_t> _opened_at{ 0 };
+
+    // Half-open episode in the high half, odd while it lasts, and the probes taken in it in the low half.
+    // The first probe to finish ends the episode; the probes of an ended one are ignored
+    std::atomic<std::uint64_t> _probes{ 0 };
+
+public:
+
+    /**
+     * \brief Constructs a closed circuit breaker
+     *
+     * \param open_error Error returned instead of calling the dependency while the circuit is open
+     * \param options Circuit breaker options
+    */
+    explicit circuit_breaker (error_type open_error, breaker_options const& options = {})
+        : _open_error{ std::move(open_error) }
+        , _options{ options }
+    {}
+
+    circuit_breaker (circuit_breaker const&) = delete;
+    auto operator = (circuit_breaker const&) -> circuit_breaker& = delete;
+
+    /**
+     * \brief Invokes the result-returning functor unless the circuit is open
+     *
+     * \param func Functor calling the dependency
+     * \param args Arguments to pass to the functor
+     *
+     * \return Result of the functor or the configured error if the call was short-circuited
+     *
+     * \throw Any exception thrown by the functor; it's counted as a failure
+    */
+    template <typename Functor, typename... Args>
+    auto call (Functor&& func, Args&&... args) -> std::invoke_result_t<Functor, Args...>
+    {
+        using result_type = std::invoke_result_t<Functor, Args...>;
+
+        static_assert(result_detail::is_result_v<result_type>, "The guarded functor must return a result");
+
+        // The episode is loaded first: an episode that ends later can't be entered or probed by a stale word
+        auto probes = _probes.load(std::memory_order_acquire);
+        auto state = _state.load(std::memory_order_acquire);
+
+        if (state == breaker_state::open) {
+            if (_ticks() - _opened_at.load(std::memory_order_relaxed) < _options.cooldown.count()) {
+                return result_type{ result<>::error(_open_error) };
+            }
+            if (!_in_episode(probes) && _probes.compare_exchange_strong(probes, _next_episode(probes), std::memory_order_acq_rel)) {
+                auto expected = breaker_state::open;
+                _state.compare_exchange_strong(expected, breaker_state::half_open, std::memory_order_acq_rel);
+            }
+            probes = _probes.load(std::memory_order_acquire);
+            state = _state.load(std::memory_order_acquire);
+
+            if (state == breaker_state::open) {
+                return result_type{ result<>::error(_open_error) };
+            }
+        }
+
+        if (state == breaker_state::half_open) {
+            do {
+                if (!_in_episode(probes) || (probes & 0xffff'ffffu) >= _options.probes) {
+                    return result_type{ result<>::error(_open_error) };
+                }
+            }
+            while (!_probes.compare_exchange_weak(probes, probes + 1, std::memory_order_acq_rel));
+
+            auto const episode = probes >> 32;
+
+            try {
+                auto res = std::invoke(std::forward<Functor>(func), std::forward<Args>(args)...);
+
+                _probed(episode, res.is_ok());
+                return res;
+            }
+            catch (...) {
+                _probed(episode, false);
+                throw;
+            }
+        }
+
+        try {
+            auto res = std::invoke(std::forward<Functor>(func), std::forward<Args>(args)...);
+
+            _record(res.is_ok());
+            return res;
+        }
+        catch (...) {
+            _record(false);
+            throw;
+        }
+    }
+
+    /**
+     * \brief Returns the current state of the circuit
+    */
+    [[nodiscard]]
+    auto state () const noexcept -> breaker_state
+    {
+        return _state.load(std::memory_order_acquire);
+    }
+
+    /**
+     * \brief Closes the circuit and drops the collected statistics
+    */
+    auto reset () noexcept -> void
+    {
+        // Ends a running half-open episode, so its probes are ignored
+        auto probes = _probes.load(std::memory_order_relaxed);
+        while (!_probes.compare_exchange_weak(probes, _next_episode(probes | (std::uint64_t{ 1 } << 32)),
+                                              std::memory_order_acq_rel));
+        _clear();
+        _state.store(breaker_state::closed, std::memory_order_release);
+    }
+
+private:
+
+    // Current time in clock ticks
+    static auto _ticks () noexcept -> std::int64_t
+    {
+        return static_cast<std::int64_t>(clock_type::now().time_since_epoch().count());
+    }
+
+    // Stripe index of the calling thread; threads are spread round-robin
+    static auto _stripe () noexcept -> std::size_t
+    {
+        static std::atomic<std::size_t> next{ 0 };
+        thread_local auto const index = next.fetch_add(1, std::memory_order_relaxed) % stripes;
+
+        return index;
+    }
+
+    // Width of a time slice in clock ticks
+    auto _slice_width () const noexcept -> std::int64_t
+    {
+        auto const width = static_cast<std::int64_t>(_options.window.count()) / std::int64_t{ slices };
+        return width > 0 ? width : 1;
+    }
+
+    // Counts a call outcome in the closed state and opens the circuit if the failure ratio is exceeded
+    auto _record (bool ok) noexcept -> void
+    {
+        auto const epoch = _ticks() / _slice_width();
+        auto& current = _slices[static_cast<std::size_t>(epoch) % slices];
+
+        if (auto seen = current.epoch.load(std::memory_order_acquire); seen != epoch) {
+            if (current.epoch.compare_exchange_strong(seen, epoch, std::memory_order_acq_rel)) {
+                for (auto& counters : current.counters) {
+                    counters.ok.store(0, std::memory_order_relaxed);
+                    counters.failed.store(0, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        auto& counters = current.counters[_stripe()];
+        (ok ? counters.ok : counters.failed).fetch_add(1, std::memory_order_relaxed);
+
+        if (ok) return;
+
+        auto calls = std::uint64_t{ 0 }, failures = std::uint64_t{ 0 };
+
+        for (auto& past : _slices) {
+            if (epoch - past.epoch.load(std::memory_order_acquire) >= std::int64_t{ slices }) continue;
+
+            for (auto& counters : past.counters) {
+                auto const failed = counters.failed.load(std::memory_order_relaxed);
+
+                failures += failed;
+                calls += failed + counters.ok.load(std::memory_order_relaxed);
+            }
+        }
+
+        if (calls >= _options.min_calls && static_cast<double>(failures) >= _options.failure_ratio * static_cast<double>(calls)) {
+            auto expected = breaker_state::closed;
+
+            // The opening time must be visible before the state that the release CAS publishes
+            if (_state.load(std::memory_order_relaxed) == expected) {
+                _opened_at.store(_ticks(), std::memory_order_relaxed);
+                _state.compare_exchange_strong(expected, breaker_state::open, std::memory_order_acq_rel);
+            }
+        }
+    }
+
+    // Returns `true` if the probes word belongs to a running half-open episode
+    static auto _in_episode (std::uint64_t probes) noexcept -> bool
+    {
+        return (probes >> 32) & 1;
+    }
+
+    // Returns the probes word of the next episode boundary with no probes taken
+    static auto _next_episode (std::uint64_t probes) noexcept -> std::uint64_t
+    {
+        return ((probes >> 32) + 1) << 32;
+    }
+
+    // Completes a probe call of the episode; only the first probe of the running episode changes the state
+    auto _probed (std::uint64_t episode, bool ok) noexcept -> void
+    {
+        auto probes = _probes.load(std::memory_order_relaxed);
+
+        do {
+            if ((probes >> 32) != episode) return;
+        }
+        while (!_probes.compare_exchange_weak(probes, _next_episode(probes), std::memory_order_acq_rel));
+
+        auto expected = breaker_state::half_open;
+
+        if (ok) {
+            if (_state.compare_exchange_strong(expected, breaker_state::closed, std::memory_order_acq_rel)) {
+                _clear();
+            }
+        }
+        else {
+            // The opening time must be visible before the state that the release CAS publishes
+            _opened_at.store(_ticks(), std::memory_order_relaxed);
+            _state.compare_exchange_strong(expected, breaker_state::open, std::memory_order_acq_rel);
+        }
+    }
+
+    // Drops all the window counters
+    auto _clear () noexcept -> void
+    {
+        for (auto& past : _slices) {
+            past.epoch.store(-1, std::memory_order_relaxed);
+
+            for (auto& counters : past.counters) {
+                counters.ok.store(0, std::memory_order_relaxed);
+                counters.failed.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+};  // end class circuit_breaker
+
+#endif  // RESULT_BREAKER_H
+
+// MIT License
+//
+// Copyright (c) 2021 Alex Qzminsky
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
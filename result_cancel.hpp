@@ -0,0 +1,418 @@
+#pragma once
+
+// Copyright © 2021 Alex Qzminsky.
+// License: MIT. All rights reserved.
+
+/// \brief Result variant type: cooperative cancellation extension
+///
+/// \author https://github.com/qzminsky
+/// \version 0.1.0
+/// \date 2026/10/16
+
+#ifndef RESULT_CANCEL_H
+#define RESULT_CANCEL_H
+
+static_assert(__cplusplus >= 2020'00, "C++20 or higher is required for the cancellation");
+
+#include "result.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <stop_token>
+#include <system_error>
+
+/**
+ * \brief State of a cancellable operation that didn't succeed
+*/
+enum class cancel_state : std::uint8_t
+{
+    failed,     ///< The operation failed with its own error
+    cancelled,  ///< Stop was requested
+    timed_out   ///< The deadline passed
+};
+
+/**
+ * \brief Customization point: error values reserved for the cancellation states
+ *
+ * \details A specialization defines static `cancelled()` and `timed_out()` returning the reserved
+ * values. Then `cancellable_error` stores the bare error, so it adds no size; an operation
+ * failing with a reserved value reads as cancelled or timed out. Without a specialization
+ * the state is stored next to the error
+*/
+template <typename Error_t>
+struct cancel_niche {};
+
+template <>
+struct cancel_niche<std::errc>
+{
+    static constexpr auto cancelled () noexcept -> std::errc { return std::errc::operation_canceled; }
+    static constexpr auto timed_out () noexcept -> std::errc { return std::errc::timed_out; }
+};
+
+template <>
+struct cancel_niche<std::error_code>
+{
+    static auto cancelled () noexcept -> std::error_code { return std::make_error_code(std::errc::operation_canceled); }
+    static auto timed_out () noexcept -> std::error_code { return std::make_error_code(std::errc::timed_out); }
+};
+
+namespace result_detail
+{
+    /// Checks if the error type has reserved cancellation values
+    template <typename Error_t, typename = void>
+    struct has_cancel_niche : std::false_type {};
+
+    template <typename Error_t>
+    struct has_cancel_niche<Error_t, std::void_t<
+        decltype(cancel_niche<Error_t>::cancelled()),
+        decltype(cancel_niche<Error_t>::timed_out())
+    >> : std::true_type {};
+
+    template <typename Error_t>
+    inline constexpr bool has_cancel_niche_v = has_cancel_niche<Error_t>::value;
+
+}   // end namespace result_detail
+
+/**
+ * \class cancellable_error
+ *
+ * \brief Error of an operation, or its cancellation, or its timeout
+ *
+ * \details Niche-encoded error type: only the error value is stored
+*/
+template <typename Error_t, bool = result_detail::has_cancel_niche_v<Error_t>>
+class cancellable_error
+{
+public:
+
+    // ANCHOR Member types
+    using error_type = Error_t;
+
+private:
+
+    using niche = cancel_niche<Error_t>;
+
+    error_type _error;
+
+public:
+
+    /**
+     * \brief Constructs a failure with the operation error
+     *
+     * \param err Error value
+    */
+    cancellable_error (error_type err) noexcept(std::is_nothrow_move_constructible_v<error_type>)
+        : _error{ std::move(err) }
+    {}
+
+    /// Returns the cancellation error
+    [[nodiscard]]
+    static auto cancelled () -> cancellable_error { return niche::cancelled(); }
+
+    /// Returns the timeout error
+    [[nodiscard]]
+    static auto timed_out () -> cancellable_error { return niche::timed_out(); }
+
+    /**
+     * \brief Returns the state of the operation
+    */
+    [[nodiscard]]
+    auto state () const -> cancel_state
+    {
+        if (_error == niche::cancelled()) return cancel_state::cancelled;
+        if (_error == niche::timed_out()) return cancel_state::timed_out;
+
+        return cancel_state::failed;
+    }
+
+    [[nodiscard]] auto is_cancelled () const -> bool { return state() == cancel_state::cancelled; }
+    [[nodiscard]] auto is_timed_out () const -> bool { return state() == cancel_state::timed_out; }
+
+    /**
+     * \brief Returns the error value; the cancellation states read as the reserved values
+    */
+    [[nodiscard]]
+    auto error () const& noexcept -> error_type const& { return _error; }
+
+    /// \copydoc error
+    [[nodiscard]]
+    auto error () && noexcept -> error_type&& { return std::move(_error); }
+
+    auto operator == (cancellable_error const& other) const -> bool { return _error == other._error; }
+
+};  // end class cancellable_error
+
+/**
+ * \brief Error of an operation, or its cancellation, or its timeout
+ *
+ * \details Tagged error type for errors without reserved values
+*/
+template <typename Error_t>
+class cancellable_error<Error_t, false>
+{
+public:
+
+    // ANCHOR Member types
+    using error_type = Error_t;
+
+private:
+
+    std::optional<error_type> _error;
+    cancel_state _state;
+
+    explicit cancellable_error (cancel_state state) noexcept : _state{ state } {}
+
+public:
+
+    /**
+     * \brief Constructs a failure with the operation error
+     *
+     * \param err Error value
+    */
+    cancellable_error (error_type err) noexcept(std::is_nothrow_move_constructible_v<error_type>)
+        : _error{ std::move(err) }
+        , _state{ cancel_state::failed }
+    {}
+
+    /// Returns the cancellation error
+    [[nodiscard]]
+    static auto cancelled () noexcept -> cancellable_error { return cancellable_error{ cancel_state::cancelled }; }
+
+    /// Returns the timeout error
+    [[nodiscard]]
+    static auto timed_out () noexcept -> cancellable_error { return cancellable_error{ cancel_state::timed_out }; }
+
+    /**
+     * \brief Returns the state of the operation
+    */
+    [[nodiscard]]
+    auto state () const noexcept -> cancel_state { return _state; }
+
+    [[nodiscard]] auto is_cancelled () const noexcept -> bool { return _state == cancel_state::cancelled; }
+    [[nodiscard]] auto is_timed_out () const noexcept -> bool { return _state == cancel_state::timed_out; }
+
+    /**
+     * \brief Returns the error value
+     *
+     * \throw bad_result_access if the operation didn't fail on its own
+    */
+    [[nodiscard]]
+    auto error () const& -> error_type const&
+    {
+        if (!_error) result_detail::throw_bad_access();
+        return *_error;
+    }
+
+    /// \copydoc error
+    [[nodiscard]]
+    auto error () && -> error_type&&
+    {
+        if (!_error) result_detail::throw_bad_access();
+        return std::move(*_error);
+    }
+
+    auto operator == (cancellable_error const& other) const -> bool
+    {
+        return _state == other._state && _error == other._error;
+    }
+
+};  // end class cancellable_error
+
+/**
+ * \brief Stop token and deadline of a cancellable operation
+*/
+class cancel_context
+{
+public:
+
+    // ANCHOR Member types
+    using clock_type = std::chrono::steady_clock;
+
+private:
+
+    std::stop_token _token;
+    clock_type::time_point _deadline;
+
+public:
+
+    /**
+     * \brief Constructs a context
+     *
+     * \param token Token to observe; a default one is never stopped
+     * \param deadline Time point after which the operation times out
+    */
+    explicit cancel_context (std::stop_token token = {}, clock_type::time_point deadline = clock_type::time_point::max()) noexcept
+        : _token{ std::move(token) }
+        , _deadline{ deadline }
+    {}
+
+    /**
+     * \brief Returns the stop token
+    */
+    [[nodiscard]]
+    auto token () const noexcept -> std::stop_token const& { return _token; }
+
+    /**
+     * \brief Returns the deadline
+    */
+    [[nodiscard]]
+    auto deadline () const noexcept -> clock_type::time_point { return _deadline; }
+
+    /**
+     * \brief Returns the state the operation should stop in, or nothing if it may continue
+     *
+     * \details The clock is read only if a deadline is set
+    */
+    [[nodiscard]]
+    auto poll () const noexcept -> std::optional<cancel_state>
+    {
+        if (_token.stop_requested()) {
+            return cancel_state::cancelled;
+        }
+        if (_deadline != clock_type::time_point::max() && clock_type::now() >= _deadline) {
+            return cancel_state::timed_out;
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * \brief Checkpoint of a cancellable operation
+     *
+     * \return Nothing if the operation may continue, or the cancellation or timeout error;
+     * suitable for `RESULT_TRY`
+    */
+    template <typename Error_t>
+    [[nodiscard]]
+    auto check () const -> result<result_monostate, cancellable_error<Error_t>>
+    {
+        using checked = result<result_monostate, cancellable_error<Error_t>>;
+
+        if (auto const state = poll()) {
+            return checked{ std::in_place_index<1>,
+                *state == cancel_state::cancelled ? cancellable_error<Error_t>::cancelled() : cancellable_error<Error_t>::timed_out()
+            };
+        }
+        return checked{ std::in_place_index<0> };
+    }
+};
+
+namespace result_detail
+{
+    /// Checks if the type is a cancellable error
+    template <typename T>
+    struct is_cancellable_error : std::false_type {};
+
+    template <typename Error_t, bool Niche>
+    struct is_cancellable_error<cancellable_error<Error_t, Niche>> : std::true_type {};
+
+    /// Result of a cancellable operation: cancellable results are kept as is
+    template <typename Result, typename = void>
+    struct cancellable_result
+    {
+        using type = result<typename Result::ok_type, cancellable_error<typename Result::error_type>>;
+    };
+
+    template <typename Result>
+    struct cancellable_result<Result, std::enable_if_t<is_cancellable_error<typename Result::error_type>::value>>
+    {
+        using type = Result;
+    };
+
+    /// Invokes the functor, passing the context first if it accepts one
+    template <typename Functor, typename... Args>
+    auto invoke_cancellable (cancel_context const& ctx, Functor&& func, Args&&... args)
+    {
+        if constexpr (std::is_invocable_v<Functor, cancel_context const&, Args...>) {
+            return std::invoke(std::forward<Functor>(func), ctx, std::forward<Args>(args)...);
+        }
+        else return std::invoke(std::forward<Functor>(func), std::forward<Args>(args)...);
+    }
+
+}   // end namespace result_detail
+
+/**
+ * \brief Invokes a result-returning functor unless the operation is already cancelled or timed out
+ *
+ * \details A functor accepting `cancel_context const&` as the first argument gets the context
+ * and may stop early at its `check()` points
+ *
+ * \param ctx Stop token and deadline
+ * \param func Result-returning functor
+ * \param args Arguments to pass to the functor
+ *
+ * \return Result of the functor with the error wrapped into `cancellable_error`
+*/
+template <typename Functor, typename... Args>
+auto with_cancellation (cancel_context const& ctx, Functor&& func, Args&&... args)
+{
+    using invoked_type = decltype(result_detail::invoke_cancellable(ctx, std::forward<Functor>(func), std::forward<Args>(args)...));
+
+    static_assert(result_detail::is_result_v<invoked_type>, "The cancellable functor must return a result");
+
+    using result_type = typename result_detail::cancellable_result<invoked_type>::type;
+    using error_type  = typename result_type::error_type;
+
+    if (auto const state = ctx.poll()) {
+        return result_type{ std::in_place_index<1>,
+            *state == cancel_state::cancelled ? error_type::cancelled() : error_type::timed_out()
+        };
+    }
+
+    auto res = result_detail::invoke_cancellable(ctx, std::forward<Functor>(func), std::forward<Args>(args)...);
+
+    if constexpr (std::is_same_v<invoked_type, result_type>) {
+        return res;
+    }
+    else if (res.is_ok()) {
+        return result_type{ std::in_place_index<0>, std::move(res).unwrap_unchecked() };
+    }
+    else return result_type{ std::in_place_index<1>, std::move(res).unwrap_error_unchecked() };
+}
+
+/**
+ * \brief Invokes a result-returning functor observing the stop token
+ *
+ * \copydetails with_cancellation
+*/
+template <typename Functor, typename... Args>
+auto with_stop_token (std::stop_token token, Functor&& func, Args&&... args)
+{
+    return with_cancellation(cancel_context{ std::move(token) }, std::forward<Functor>(func), std::forward<Args>(args)...);
+}
+
+/**
+ * \brief Invokes a result-returning functor that times out at the deadline
+ *
+ * \copydetails with_cancellation
+*/
+template <typename Functor, typename... Args>
+auto with_deadline (cancel_context::clock_type::time_point deadline, Functor&& func, Args&&... args)
+{
+    return with_cancellation(cancel_context{ {}, deadline }, std::forward<Functor>(func), std::forward<Args>(args)...);
+}
+
+#endif  // RESULT_CANCEL_H
+
+// MIT License
+//
+// Copyright (c) 2021 Alex Qzminsky
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
@@ -0,0 +1,365 @@
+#pragma once
+
+// Copyright © 2021 Alex Qzminsky.
+// License: MIT. All rights reserved.
+
+/// \brief Result variant type: bounded multi-producer multi-consumer channel
+///
+/// \author https://github.com/qzminsky
+/// \version 0.1.0
+/// \date 2026/10/16
+
+#ifndef RESULT_CHANNEL_H
+#define RESULT_CHANNEL_H
+
+static_assert(__cplusplus >= 2020'00, "C++20 or higher is required for the channel");
+
+#include "result.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+
+/**
+ * \brief Reason of a failed channel operation
+*/
+enum class channel_status : std::uint8_t
+{
+    closed,     ///< The channel is closed; receivers get this once all the sent values are received
+    empty,      ///< `try_recv` found no value
+    full        ///< `try_send` found no free slot
+};
+
+/**
+ * \brief Error of a channel operation
+*/
+template <typename Error_t>
+struct channel_error
+{
+    channel_status status;
+
+    /// Terminal error passed to `close`; set only if the status is `closed`
+    std::optional<Error_t> reason;
+};
+
+/**
+ * \class result_channel
+ *
+ * \brief Bounded lock-free queue of values with an in-band terminal error
+ *
+ * \details Slots form a ring with a sequence number each (D. Vyukov's bounded MPMC queue), so
+ * producers and consumers claim positions with a single CAS and never take a lock. Closing
+ * the channel stops the producers; receivers get the remaining values first and then the terminal
+ * error. Blocked senders and receivers sleep in `std::atomic::wait`, which is a futex on Linux;
+ * the other side calls `notify` only if someone is asleep
+*/
+template <typename Ok_t, typename Error_t>
+class result_channel
+{
+    static_assert(std::is_nothrow_move_constructible_v<Ok_t>,
+                  "A slot is claimed before the value is moved in or out, so the move must not throw");
+
+public:
+
+    // ANCHOR Member types
+    using value_type = Ok_t;
+    using error_type = Error_t;
+
+    using recv_type = result<value_type, channel_error<error_type>>;
+    using send_type = result<result_monostate, channel_error<error_type>>;
+
+private:
+
+    // Set in the tail position once the channel is closed
+    static constexpr std::size_t closed_bit = ~(~std::size_t{ 0 } >> 1);
+
+    struct slot
+    {
+        std::atomic<std::size_t> sequence;
+        alignas(value_type) unsigned char value[sizeof(value_type)];
+
+        auto get () noexcept -> value_type* { return std::launder(reinterpret_cast<value_type*>(value)); }
+    };
+
+    // Sleeping side of the channel: epoch to wait on and the number of sleepers
+    struct alignas(64) waiters
+    {
+        std::atomic<std::uint32_t> epoch{ 0 };
+        std::atomic<std::uint32_t> count{ 0 };
+
+        // Wakes the sleepers, if any. The fence orders the preceding publication before the check
+        auto wake_one () noexcept -> void
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (count.load(std::memory_order_relaxed) != 0) {
+                epoch.fetch_add(1, std::memory_order_release);
+                epoch.notify_one();
+            }
+        }
+
+        auto wake_all () noexcept -> void
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (count.load(std::memory_order_relaxed) != 0) {
+                epoch.fetch_add(1, std::memory_order_release);
+                epoch.notify_all();
+            }
+        }
+
+        // Repeats the attempt until it doesn't report `retry`, sleeping between the attempts
+        template <typename Attempt>
+        auto block (Attempt&& attempt, channel_status retry)
+        {
+            for (;;) {
+                if (auto res = attempt(); res.is_ok() || res.unwrap_error_unchecked().status != retry) {
+                    return res;
+                }
+
+                count.fetch_add(1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                auto const seen = epoch.load(std::memory_order_acquire);
+                auto res = attempt();
+
+                if (res.is_ok() || res.unwrap_error_unchecked().status != retry) {
+                    count.fetch_sub(1, std::memory_order_relaxed);
+                    return res;
+                }
+                epoch.wait(seen, std::memory_order_acquire);
+                count.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    std::unique_ptr<slot[]> _slots;
+    std::size_t _mask;
+
+    alignas(64) std::atomic<std::size_t> _head{ 0 };
+    alignas(64) std::atomic<std::size_t> _tail{ 0 };
+
+    waiters _receivers;
+    waiters _senders;
+
+    std::atomic<bool> _closing{ false };
+    std::optional<error_type> _reason;
+
+public:
+
+    /**
+     * \brief Constructs an open channel
+     *
+     * \param capacity Maximal number of buffered values; rounded up to a power of two
+    */
+    explicit result_channel (std::size_t capacity)
+    {
+        auto size = std::size_t{ 2 };
+
+        while (size < capacity) size <<= 1;
+
+        _slots = std::make_unique<slot[]>(size);
+        _mask = size - 1;
+
+        for (auto i = std::size_t{ 0 }; i < size; ++i) {
+            _slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    result_channel (result_channel const&) = delete;
+    auto operator = (result_channel const&) -> result_channel& = delete;
+
+    ~result_channel ()
+    {
+        auto const tail = _tail.load(std::memory_order_relaxed) & ~closed_bit;
+
+        for (auto pos = _head.load(std::memory_order_relaxed); pos != tail; ++pos) {
+            _slots[pos & _mask].get()->~value_type();
+        }
+    }
+
+    /**
+     * \brief Puts the value into the channel if there is a free slot
+     *
+     * \param val Value or arguments to construct it; left intact if the value isn't sent, unless
+     * it's an rvalue that is converted before the attempt
+     *
+     * \return Nothing, or the error with the `full` or `closed` status
+    */
+    template <typename T>
+    [[nodiscard]]
+    auto try_send (T&& val) -> send_type
+    {
+        // A conversion that may throw must happen before a slot is claimed: the slot would never be published
+        if constexpr (!std::is_nothrow_constructible_v<value_type, T&&>) {
+            return try_send(value_type(std::forward<T>(val)));
+        }
+        auto pos = _tail.load(std::memory_order_relaxed);
+
+        for (;;) {
+            if (pos & closed_bit) {
+                return _closed<result_monostate>();
+            }
+
+            auto& s = _slots[pos & _mask];
+            auto const diff = static_cast<std::intptr_t>(s.sequence.load(std::memory_order_acquire) - pos);
+
+            if (diff == 0) {
+                if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    ::new (static_cast<void*>(s.value)) value_type(std::forward<T>(val));
+                    s.sequence.store(pos + 1, std::memory_order_release);
+
+                    _receivers.wake_one();
+                    return send_type{ std::in_place_index<0> };
+                }
+            }
+            else if (diff < 0) {
+                return send_type{ std::in_place_index<1>, channel_error<error_type>{ channel_status::full, std::nullopt } };
+            }
+            else pos = _tail.load(std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * \brief Puts the value into the channel, waiting for a free slot
+     *
+     * \param val Value or arguments to construct it; left intact if the channel is closed
+     *
+     * \return Nothing, or the error with the `closed` status
+    */
+    template <typename T>
+    auto send (T&& val) -> send_type
+    {
+        if constexpr (!std::is_nothrow_constructible_v<value_type, T&&>) {
+            return send(value_type(std::forward<T>(val)));
+        }
+        return _senders.block([&] { return try_send(std::forward<T>(val)); }, channel_status::full);
+    }
+
+    /**
+     * \brief Takes a value from the channel if there is one
+     *
+     * \return The value, or the error with the `empty` or `closed` status. The `closed` error
+     * comes only after all the sent values are received and carries the terminal error
+    */
+    [[nodiscard]]
+    auto try_recv () -> recv_type
+    {
+        auto pos = _head.load(std::memory_order_relaxed);
+
+        for (;;) {
+            auto& s = _slots[pos & _mask];
+            auto const diff = static_cast<std::intptr_t>(s.sequence.load(std::memory_order_acquire) - (pos + 1));
+
+            if (diff == 0) {
+                if (_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    auto res = recv_type{ std::in_place_index<0>, std::move(*s.get()) };
+
+                    s.get()->~value_type();
+                    s.sequence.store(pos + _mask + 1, std::memory_order_release);
+
+                    _senders.wake_one();
+                    return res;
+                }
+            }
+            else if (diff < 0) {
+                // A closed channel may still have claimed slots that aren't written yet
+                if (_tail.load(std::memory_order_acquire) == (pos | closed_bit)) {
+                    return _closed<value_type>();
+                }
+                return recv_type{ std::in_place_index<1>, channel_error<error_type>{ channel_status::empty, std::nullopt } };
+            }
+            else pos = _head.load(std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * \brief Takes a value from the channel, waiting for one
+     *
+     * \return The value, or the error with the `closed` status and the terminal error
+    */
+    auto recv () -> recv_type
+    {
+        return _receivers.block([this] { return try_recv(); }, channel_status::empty);
+    }
+
+    /**
+     * \brief Closes the channel: further sends fail, receivers get the terminal error after the remaining values
+     *
+     * \param reason Terminal error delivered to every receiver
+     *
+     * \return `false` if the channel was already closed; the reason is dropped then
+    */
+    auto close (error_type reason) -> bool
+    {
+        if (_closing.exchange(true, std::memory_order_acq_rel)) {
+            return false;
+        }
+        _reason.emplace(std::move(reason));
+        _tail.fetch_or(closed_bit, std::memory_order_acq_rel);
+
+        _receivers.wake_all();
+        _senders.wake_all();
+        return true;
+    }
+
+    /**
+     * \brief Returns `true` if the channel is closed
+    */
+    [[nodiscard]]
+    auto is_closed () const noexcept -> bool
+    {
+        return _tail.load(std::memory_order_acquire) & closed_bit;
+    }
+
+    /**
+     * \brief Returns the number of slots
+    */
+    [[nodiscard]]
+    auto capacity () const noexcept -> std::size_t
+    {
+        return _mask + 1;
+    }
+
+private:
+
+    // Returns the `closed` error with a copy of the terminal error. The fence pairs with `close`,
+    // since the closed bit may have been seen by a relaxed load
+    template <typename T>
+    auto _closed () const -> result<T, channel_error<error_type>>
+    {
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        return result<T, channel_error<error_type>>{
+            std::in_place_index<1>, channel_error<error_type>{ channel_status::closed, _reason }
+        };
+    }
+
+};  // end class result_channel
+
+#endif  // RESULT_CHANNEL_H
+
+// MIT License
+//
+// Copyright (c) 2021 Alex Qzminsky
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
@@ -0,0 +1,84 @@
+// Copyright © 2021 Alex Qzminsky.
+// License: MIT. All rights reserved.
+
+/// \brief Result variant type: code generation probe
+///
+/// \details Defines one function per hot-path operation. `result_codegen_check.sh` compiles
+/// this file with optimizations and checks the disassembly of every `codegen_` function.
+/// Compile-time regressions of the converting constructor are asserted here as well
+///
+/// \author https://github.com/qzminsky
+/// \version 0.1.0
+/// \date 2026/10/16
+
+#include "result.inl"
+
+#include <functional>
+#include <string_view>
+#include <type_traits>
+
+using probe_type = result<int, int>;
+
+// A string literal doesn't select `bool` through the pointer conversion
+static_assert(result<bool, std::string_view>{ "abc" }.is_error());
+static_assert(result<bool, std::string_view>{ true }.is_ok());
+
+// Narrowing conversions aren't candidates: `int` selects `long`, not `float`
+static_assert(result<float, long>{ 3 }.is_error());
+static_assert(result<int, std::string_view>{ 5 }.is_ok());
+
+// Results of other types convert only without narrowing
+static_assert(!std::is_convertible_v<result<double, char>, result<int, char>>);
+static_assert(std::is_convertible_v<result<int, char>, result<long, int>>);
+
+auto codegen_is_ok (probe_type const& res) -> bool
+{
+    return res.is_ok();
+}
+
+auto codegen_unwrap_unchecked (probe_type const& res) -> int
+{
+    return res.unwrap_unchecked();
+}
+
+auto codegen_ok (int value) -> probe_type
+{
+    return Ok(value);
+}
+
+auto codegen_unwrap_or (probe_type const& res, int value) -> int
+{
+    return res.unwrap_or(value);
+}
+
+auto codegen_match (probe_type const& res) -> int
+{
+    return res.match([](int val) { return val; }, [](int err) { return -err; });
+}
+
+auto codegen_hash (probe_type const& res) -> std::size_t
+{
+    return std::hash<probe_type>{}(res);
+}
+
+// MIT License
+//
+// Copyright (c) 2021 Alex Qzminsky
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
@@ -0,0 +1,83 @@
+#!/bin/sh
+
+# Copyright © 2021 Alex Qzminsky.
+# License: MIT. All rights reserved.
+
+# Result variant type: code generation check
+#
+# Compiles result_codegen_check.cpp in the default and the RESULT_LIGHTWEIGHT configurations
+# and checks the disassembly of every codegen_ function:
+# * no call or tail call to another function;
+# * no relocation against a __throw_ function;
+# * no result written through a hidden pointer, so a result<int, int> is returned in rax;
+# * no more instructions than its ceiling in CEILINGS, not counting the padding and the cold clone.
+# Prints one line per function and exits with 1 if any expectation fails. x86-64 only.
+#
+# Usage: ./result_codegen_check.sh
+# Environment: CXX (default: c++), CXXFLAGS (default: -std=c++17 -O2 -DNDEBUG), OBJDUMP (default: objdump),
+#              CEILINGS (default: the table below)
+
+# Maximal instruction counts, as emitted by g++ 12 at -O2 in either configuration:
+# is_ok is one compare, unwrap_unchecked one load, Ok(int) packs the value and the index into rax
+CEILINGS=${CEILINGS:-"is_ok=3 unwrap_unchecked=2 ok=4 unwrap_or=5 match=10 hash=16"}
+
+CXX=${CXX:-c++}
+CXXFLAGS=${CXXFLAGS:--std=c++17 -O2 -DNDEBUG}
+OBJDUMP=${OBJDUMP:-objdump}
+
+cd "$(dirname "$0")" || exit 1
+
+case "$($CXX -dumpmachine)" in
+    x86_64-*) ;;
+    *) echo "skipped: x86-64 target required"; exit 0 ;;
+esac
+
+object=$(mktemp) || exit 1
+trap 'rm -f "$object"' EXIT
+
+status=0
+
+for config in default lightweight; do
+    defines=""
+    [ "$config" = lightweight ] && defines="-DRESULT_LIGHTWEIGHT"
+
+    # shellcheck disable=SC2086
+    $CXX $CXXFLAGS $defines -c result_codegen_check.cpp -o "$object" || exit 1
+
+    # Cold clones are listed under the name of their function, so their calls count too
+    $OBJDUMP -d -r -C --no-show-raw-insn "$object" | awk -v config="$config" -v ceilings="$CEILINGS" '
+        BEGIN {
+            split(ceilings, entries, " ")
+            for (i in entries) { split(entries[i], entry, "="); ceiling[entry[1]] = entry[2] }
+        }
+        /^[0-9a-f]+ <codegen_/ {
+            name = $2; sub(/^<codegen_/, "", name); sub(/\(.*$/, "", name)
+            if (!(name in seen)) { seen[name] = 1; order[++count] = name }
+            current = name
+            cold = /\[clone \.cold\]/
+            next
+        }
+        /^[0-9a-f]+ </ { current = ""; next }
+        current == "" { next }
+        /^ *[0-9a-f]+:\t/ && !cold {
+            split($0, field, "\t")
+            if (field[2] !~ /^(nop|xchg +%ax,%ax|data16|cs nop)/) ++size[current]
+        }
+        /__throw_/ { failed[current] = failed[current] " throw" }
+        /\t(call|jmp)[a-z]* +[0-9a-f]+ </ && !/<codegen_/ { failed[current] = failed[current] " call" }
+        /\tcall/ && /\*/ { failed[current] = failed[current] " call" }
+        /\tmov[a-z]* +[^,]+,[^(]*\(%rdi\)/ { failed[current] = failed[current] " sret" }
+        END {
+            for (i = 1; i <= count; ++i) {
+                name = order[i]
+                if (!(name in ceiling)) failed[name] = failed[name] " no-ceiling"
+                else if (size[name] > ceiling[name]) failed[name] = failed[name] " size=" size[name] ">" ceiling[name]
+                if (name in failed) { printf "FAIL %s %s:%s\n", config, name, failed[name]; bad = 1 }
+                else printf "ok   %s %s (%d of %d instructions)\n", config, name, size[name], ceiling[name]
+            }
+            exit bad
+        }
+    ' || status=1
+done
+
+exit $status
@@ -0,0 +1,96 @@
+// Copyright © 2021 Alex Qzminsky.
+// License: MIT. All rights reserved.
+
+/// \brief Result variant type: compile-time benchmark
+///
+/// \details Instantiates `RESULT_BENCH_N` distinct result types with the common operations.
+/// Compiled repeatedly by `result_compile_bench.sh` to compare the default and the
+/// `RESULT_LIGHTWEIGHT` configurations
+///
+/// \author https://github.com/qzminsky
+/// \version 0.1.0
+/// \date 2026/10/16
+
+#include "result.inl"
+
+#include <utility>
+
+#ifndef RESULT_BENCH_N
+#   define RESULT_BENCH_N 100
+#endif
+
+namespace
+{
+    template <std::size_t I>
+    struct ok_value
+    {
+        int value;
+
+        auto operator == (ok_value const& other) const -> bool { return value == other.value; }
+    };
+
+    template <std::size_t I>
+    struct error_value
+    {
+        int code;
+
+        auto operator == (error_value const& other) const -> bool { return code == other.code; }
+    };
+
+    template <std::size_t I>
+    auto produce (int x) -> result<ok_value<I>, error_value<I>>
+    {
+        if (x < 0) return Error(error_value<I>{ x });
+        return Ok(ok_value<I>{ x });
+    }
+
+    template <std::size_t I>
+    auto consume (int x) -> int
+    {
+        auto res = produce<I>(x);
+        auto sum = 0;
+
+        res.if_ok([&](ok_value<I> const& val) { sum += val.value; })
+           .if_error([&](error_value<I> const& err) { sum -= err.code; });
+
+        sum += res.match([](ok_value<I> const& val) { return val.value; }, [] { return 0; });
+        sum += res.unwrap_or(ok_value<I>{ 0 }).value;
+        sum += res == Ok(ok_value<I>{ x });
+
+        return sum;
+    }
+
+    template <std::size_t... I>
+    auto consume_all (int x, std::index_sequence<I...>) -> int
+    {
+        return (consume<I>(x) + ...);
+    }
+
+}   // end anonymous namespace
+
+auto main (int argc, char**) -> int
+{
+    return consume_all(argc, std::make_index_sequence<RESULT_BENCH_N>{});
+}
+
+// MIT License
+//
+// Copyright (c) 2021 Alex Qzminsky
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
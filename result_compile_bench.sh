@@ -0,0 +1,36 @@
+#!/bin/sh
+
+# Copyright © 2021 Alex Qzminsky.
+# License: MIT. All rights reserved.
+
+# Result variant type: compile-time benchmark driver
+#
+# Compiles result_compile_bench.cpp M times with N distinct result instantiations,
+# in the default and the RESULT_LIGHTWEIGHT configurations. Prints one JSON object per line.
+#
+# Usage: ./result_compile_bench.sh [N] [M]
+# Environment: CXX (default: c++), CXXFLAGS (default: -std=c++20 -O0)
+
+N=${1:-100}
+M=${2:-4}
+CXX=${CXX:-c++}
+CXXFLAGS=${CXXFLAGS:--std=c++20 -O0}
+
+cd "$(dirname "$0")" || exit 1
+
+for config in default lightweight; do
+    defines="-DRESULT_BENCH_N=$N"
+    [ "$config" = lightweight ] && defines="$defines -DRESULT_LIGHTWEIGHT"
+
+    start=$(date +%s%N)
+    i=0
+    while [ "$i" -lt "$M" ]; do
+        # shellcheck disable=SC2086
+        $CXX $CXXFLAGS $defines -c result_compile_bench.cpp -o /dev/null || exit 1
+        i=$((i + 1))
+    done
+    end=$(date +%s%N)
+
+    printf '{"config": "%s", "instantiations": %s, "tus": %s, "ms_per_tu": %s}\n' \
+        "$config" "$N" "$M" "$(( (end - start) / M / 1000000 ))"
+done
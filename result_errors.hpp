@@ -0,0 +1,269 @@
+#pragma once
+
+// Copyright © 2021 Alex Qzminsky.
+// License: MIT. All rights reserved.
+
+/// \brief Result variant type: error sets extension
+///
+/// \author https://github.com/qzminsky
+/// \version 0.1.0
+/// \date 2026/10/16
+
+#ifndef RESULT_ERRORS_H
+#define RESULT_ERRORS_H
+
+static_assert(__cplusplus >= 2017'00, "C++17 or higher is required");
+
+#include "result.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+template <typename... Errors>
+class error_set;
+
+namespace result_detail
+{
+    /// List of types
+    template <typename... Ts>
+    struct type_list {};
+
+    /// Appends the types to the list, skipping the ones already there
+    template <typename List, typename... Ts>
+    struct set_merge
+    {
+        using type = List;
+    };
+
+    /// Appends a type to the list unless it's already there; nested error sets are flattened
+    template <typename List, typename T>
+    struct set_insert;
+
+    template <typename... Ts, typename T>
+    struct set_insert<type_list<Ts...>, T>
+    {
+        using type = std::conditional_t<(std::is_same_v<T, Ts> || ...), type_list<Ts...>, type_list<Ts..., T>>;
+    };
+
+    template <typename... Ts, typename... Nested>
+    struct set_insert<type_list<Ts...>, error_set<Nested...>>
+    {
+        using type = typename set_merge<type_list<Ts...>, Nested...>::type;
+    };
+
+    template <typename List, typename T, typename... Ts>
+    struct set_merge<List, T, Ts...>
+    {
+        using type = typename set_merge<typename set_insert<List, T>::type, Ts...>::type;
+    };
+
+    /// Error set of the distinct types
+    template <typename List>
+    struct error_set_of;
+
+    template <typename... Ts>
+    struct error_set_of<type_list<Ts...>>
+    {
+        using type = error_set<Ts...>;
+    };
+
+    /// Index of the type in the list; the size of the list if it's absent
+    template <typename T, typename... Ts>
+    inline constexpr std::size_t index_of_v = [] {
+        constexpr bool matches[] = { std::is_same_v<T, Ts>..., false };
+
+        auto i = std::size_t{ 0 };
+        while (i < sizeof...(Ts) && !matches[i]) ++i;
+        return i;
+    }();
+
+    /// Checks if the type is an error set
+    template <typename T>
+    struct is_error_set : std::false_type {};
+
+    template <typename... Errors>
+    struct is_error_set<error_set<Errors...>> : std::true_type {};
+
+}   // end namespace result_detail
+
+/// Error set of the distinct error types in order of appearance; nested sets are flattened
+template <typename... Errors>
+using errors = typename result_detail::error_set_of<
+    typename result_detail::set_merge<result_detail::type_list<>, Errors...>::type
+>::type;
+
+/**
+ * \class error_set
+ *
+ * \brief Tagged union of error types that widens implicitly
+ *
+ * \details Use the `errors` alias, which removes duplicates. A set converts to any set containing
+ * its types: the tag is remapped through a table computed at compile time and the error is moved
+ * in place, without virtual calls or allocations
+*/
+template <typename... Errors>
+class error_set
+{
+    static_assert(sizeof...(Errors) > 0, "An error set must contain a type");
+
+    template <typename... Others>
+    friend class error_set;
+
+    std::variant<Errors...> _value;
+
+    // Checks if the type is a member of the set
+    template <typename T>
+    static constexpr bool _contains = result_detail::index_of_v<T, Errors...> < sizeof...(Errors);
+
+public:
+
+    /**
+     * \brief Constructs an error of a member type
+     *
+     * \param err Error value
+    */
+    template <typename Error_t,
+              typename = std::enable_if_t<_contains<std::decay_t<Error_t>>>
+    >
+    constexpr error_set (Error_t&& err) noexcept(std::is_nothrow_constructible_v<std::decay_t<Error_t>, Error_t&&>)
+        : _value{ std::in_place_index<result_detail::index_of_v<std::decay_t<Error_t>, Errors...>>, std::forward<Error_t>(err) }
+    {}
+
+    /**
+     * \brief Constructs an error of the specified member type in place
+     *
+     * \param args Arguments to construct the error from
+    */
+    template <typename Error_t, typename... Args,
+              typename = std::enable_if_t<_contains<Error_t>>
+    >
+    constexpr explicit error_set (std::in_place_type_t<Error_t>, Args&&... args)
+        : _value{ std::in_place_index<result_detail::index_of_v<Error_t, Errors...>>, std::forward<Args>(args)... }
+    {}
+
+    /**
+     * \brief Widening conversion from a subset
+     *
+     * \param other Error set whose types are all members of this one
+    */
+    template <typename... Others,
+              typename = std::enable_if_t<!std::is_same_v<error_set<Others...>, error_set> && (_contains<Others> && ...)>
+    >
+    constexpr error_set (error_set<Others...> const& other) : _value{ _widen(other._value, std::index_sequence_for<Others...>{}) } {}
+
+    /// \copydoc error_set(error_set<Others...> const&)
+    template <typename... Others,
+              typename = std::enable_if_t<!std::is_same_v<error_set<Others...>, error_set> && (_contains<Others> && ...)>
+    >
+    constexpr error_set (error_set<Others...>&& other) : _value{ _widen(std::move(other._value), std::index_sequence_for<Others...>{}) } {}
+
+    /**
+     * \brief Returns the index of the stored type in the set
+    */
+    [[nodiscard]]
+    constexpr auto index () const noexcept -> std::size_t
+    {
+        return _value.index();
+    }
+
+    /**
+     * \brief Checks if the stored error has the specified type
+    */
+    template <typename Error_t>
+    [[nodiscard]]
+    constexpr auto is () const noexcept -> bool
+    {
+        static_assert(_contains<Error_t>, "The type isn't a member of the error set");
+
+        return _value.index() == result_detail::index_of_v<Error_t, Errors...>;
+    }
+
+    /**
+     * \brief Returns the stored error of the specified type, or `nullptr` if it's of another type
+    */
+    template <typename Error_t>
+    [[nodiscard]]
+    constexpr auto as () noexcept -> Error_t*
+    {
+        return std::get_if<result_detail::index_of_v<Error_t, Errors...>>(&_value);
+    }
+
+    /// \copydoc as
+    template <typename Error_t>
+    [[nodiscard]]
+    constexpr auto as () const noexcept -> Error_t const*
+    {
+        return std::get_if<result_detail::index_of_v<Error_t, Errors...>>(&_value);
+    }
+
+    /**
+     * \brief Invokes the functor with the stored error
+     *
+     * \param func Functor accepting every member type
+    */
+    template <typename Functor>
+    constexpr auto visit (Functor&& func) const& -> decltype(auto)
+    {
+        return std::visit(std::forward<Functor>(func), _value);
+    }
+
+    /// \copydoc visit
+    template <typename Functor>
+    constexpr auto visit (Functor&& func) && -> decltype(auto)
+    {
+        return std::visit(std::forward<Functor>(func), std::move(_value));
+    }
+
+    constexpr auto operator == (error_set const& other) const -> bool { return _value == other._value; }
+    constexpr auto operator != (error_set const& other) const -> bool { return _value != other._value; }
+
+private:
+
+    // Moves or copies the active error of a subset into the slot remapped at compile time
+    template <typename Variant, std::size_t... Is>
+    static constexpr auto _widen (Variant&& from, std::index_sequence<Is...>) -> std::variant<Errors...>
+    {
+        using from_type = std::decay_t<Variant>;
+        using table_type = auto (*) (Variant&&) -> std::variant<Errors...>;
+
+        constexpr table_type table[] = {
+            [](Variant&& v) -> std::variant<Errors...> {
+                using type = std::variant_alternative_t<Is, from_type>;
+                using source = std::conditional_t<std::is_lvalue_reference_v<Variant>, type const&, type&&>;
+
+                return std::variant<Errors...>{
+                    std::in_place_index<result_detail::index_of_v<type, Errors...>>, static_cast<source>(*std::get_if<Is>(&v))
+                };
+            }...
+        };
+        return table[from.index()](std::forward<Variant>(from));
+    }
+
+};  // end class error_set
+
+#endif  // RESULT_ERRORS_H
+
+// MIT License
+//
+// Copyright (c) 2021 Alex Qzminsky
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
@@ -0,0 +1,116 @@
+#pragma once
+
+// Copyright © 2021 Alex Qzminsky.
+// License: MIT. All rights reserved.
+
+/// \brief Result variant type: exceptions bridge extension
+///
+/// \author https://github.com/qzminsky
+/// \version 0.1.0
+/// \date 2026/10/16
+
+#ifndef RESULT_EXCEPT_H
+#define RESULT_EXCEPT_H
+
+static_assert(__cplusplus >= 2017'00, "C++17 or higher is required");
+
+#include "result.hpp"
+
+#include <exception>
+#include <functional>
+
+namespace result_detail
+{
+    /// Value type of a result capturing the return of a functor: `void` maps to `result_monostate`
+    template <typename Functor>
+    using call_value_t = std::conditional_t<std::is_void_v<std::invoke_result_t<Functor>>,
+        result_monostate,
+        std::remove_cv_t<std::remove_reference_t<std::invoke_result_t<Functor>>>
+    >;
+
+    /// Invokes the functor and stores its return value as a success result
+    template <typename Result, typename Functor>
+    auto call_into (Functor&& func) -> Result
+    {
+        if constexpr (std::is_void_v<std::invoke_result_t<Functor>>) {
+            std::invoke(std::forward<Functor>(func));
+            return Result{ std::in_place_index<0> };
+        }
+        else return Result{ std::in_place_index<0>, std::invoke(std::forward<Functor>(func)) };
+    }
+
+}   // end namespace result_detail
+
+/**
+ * \brief Invokes a throwing functor and captures its return value or exception
+ *
+ * \param func Functor to invoke
+ *
+ * \return Success result with the returned value (`result_monostate` for `void`) or failure
+ * result with the thrown exception
+*/
+template <typename Functor>
+auto result_from_call (Functor&& func) noexcept -> result<result_detail::call_value_t<Functor>, std::exception_ptr>
+{
+    using result_type = result<result_detail::call_value_t<Functor>, std::exception_ptr>;
+
+    try {
+        return result_detail::call_into<result_type>(std::forward<Functor>(func));
+    }
+    catch (...) {
+        return result_type{ std::in_place_index<1>, std::current_exception() };
+    }
+}
+
+/**
+ * \brief Invokes a throwing functor and maps a thrown `std::exception` to a typed error
+ *
+ * \details The exception is mapped inside the handler, so no `std::exception_ptr` is allocated.
+ * Exceptions not derived from `std::exception`, and the ones thrown by the mapping, propagate
+ *
+ * \param func Functor to invoke
+ * \param mapping Functor taking `std::exception const&` and returning the error value
+ *
+ * \return Success result with the returned value (`result_monostate` for `void`) or failure
+ * result with the mapped error
+*/
+template <typename Functor, typename Mapping>
+auto result_from_call (Functor&& func, Mapping&& mapping)
+    -> result<result_detail::call_value_t<Functor>, std::decay_t<std::invoke_result_t<Mapping&, std::exception const&>>>
+{
+    using result_type = result<
+        result_detail::call_value_t<Functor>,
+        std::decay_t<std::invoke_result_t<Mapping&, std::exception const&>>
+    >;
+
+    try {
+        return result_detail::call_into<result_type>(std::forward<Functor>(func));
+    }
+    catch (std::exception const& e) {
+        return result_type{ std::in_place_index<1>, std::invoke(mapping, e) };
+    }
+}
+
+#endif  // RESULT_EXCEPT_H
+
+// MIT License
+//
+// Copyright (c) 2021 Alex Qzminsky
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
@@ -0,0 +1,210 @@
+#pragma once
+
+// Copyright © 2021 Alex Qzminsky.
+// License: MIT. All rights reserved.
+
+/// \brief Result variant type: formatting extension
+///
+/// \details Specializes `std::formatter` if `<format>` is available, and `fmt::formatter` if
+/// `<fmt/format.h>` is included before this header or `RESULT_FMT` is defined
+///
+/// \author https://github.com/qzminsky
+/// \version 0.1.0
+/// \date 2026/10/16
+
+#ifndef RESULT_FORMAT_H
+#define RESULT_FORMAT_H
+
+static_assert(__cplusplus >= 2017'00, "C++17 or higher is required");
+
+#include "result.hpp"
+
+#include <cstdint>
+
+#if __has_include(<version>)
+#   include <version>
+#endif
+
+#ifdef __cpp_lib_format
+#   include <format>
+#endif
+
+#if defined(RESULT_FMT) && !defined(FMT_VERSION)
+#   include <fmt/format.h>
+#endif
+
+namespace result_detail
+{
+    /// Formatter of the empty value: prints nothing
+    struct monostate_formatter
+    {
+        template <typename Parse_Context>
+        constexpr auto parse (Parse_Context& ctx) -> typename Parse_Context::iterator
+        {
+            return ctx.begin();
+        }
+
+        template <typename Format_Context>
+        auto format (result_monostate, Format_Context& ctx) const -> typename Format_Context::iterator
+        {
+            return ctx.out();
+        }
+    };
+
+    /// Formatter of a value of the library; the empty value has its own one
+    template <typename T, typename Formatter>
+    using value_formatter = std::conditional_t<std::is_same_v<T, result_monostate>, monostate_formatter, Formatter>;
+
+    /// Part of a result selected by the format specification
+    enum class format_mode : std::uint8_t
+    {
+        value,  ///< `{}`: the value of either state
+        debug,  ///< `{:?}`: the value wrapped into `ok(...)` or `err(...)`
+        ok,     ///< `{:ok}`: the success value; a failure prints nothing
+        error   ///< `{:err}`: the error value; a success prints nothing
+    };
+
+    /**
+     * \brief Formatter of results shared by `std::format` and fmt
+     *
+     * \details Specification: `[ok|err|?][:value-spec]`. The value specification is passed to the
+     * value formatters; it's allowed only with `ok` or `err`, which select one of them.
+     * The values are formatted in place, right into the output iterator
+    */
+    template <typename Ok_Formatter, typename Error_Formatter, typename Format_Error>
+    class result_formatter
+    {
+        Ok_Formatter _ok;
+        Error_Formatter _error;
+        format_mode _mode = format_mode::value;
+
+    public:
+
+        template <typename Parse_Context>
+        constexpr auto parse (Parse_Context& ctx) -> typename Parse_Context::iterator
+        {
+            auto it = ctx.begin();
+            auto const end = ctx.end();
+
+            auto const skip = [&](char const* word) {
+                auto next = it;
+
+                for (; *word != '\0'; ++word, ++next) {
+                    if (next == end || *next != *word) return false;
+                }
+                it = next;
+                return true;
+            };
+
+            if (skip("ok")) {
+                _mode = format_mode::ok;
+            }
+            else if (skip("err")) {
+                _mode = format_mode::error;
+            }
+            else if (skip("?")) {
+                _mode = format_mode::debug;
+            }
+
+            if (it != end && *it == ':' && (_mode == format_mode::ok || _mode == format_mode::error)) {
+                ctx.advance_to(++it);
+
+                if (_mode == format_mode::ok) return _ok.parse(ctx);
+                return _error.parse(ctx);
+            }
+            if (it != end && *it != '}') {
+                throw Format_Error("invalid format specification for a result");
+            }
+
+            ctx.advance_to(it);
+            _ok.parse(ctx);
+
+            return _error.parse(ctx);
+        }
+
+        template <typename Ok_t, typename Error_t, typename Format_Context>
+        auto format (result<Ok_t, Error_t> const& res, Format_Context& ctx) const -> typename Format_Context::iterator
+        {
+            if (res.is_ok()) {
+                if (_mode == format_mode::error) return ctx.out();
+                if (_mode != format_mode::debug) return _ok.format(res.unwrap_unchecked(), ctx);
+
+                ctx.advance_to(_put(ctx.out(), "ok("));
+                ctx.advance_to(_ok.format(res.unwrap_unchecked(), ctx));
+            }
+            else {
+                if (_mode == format_mode::ok) return ctx.out();
+                if (_mode != format_mode::debug) return _error.format(res.unwrap_error_unchecked(), ctx);
+
+                ctx.advance_to(_put(ctx.out(), "err("));
+                ctx.advance_to(_error.format(res.unwrap_error_unchecked(), ctx));
+            }
+            return _put(ctx.out(), ")");
+        }
+
+    private:
+
+        // Writes the text to the output
+        template <typename Output>
+        static auto _put (Output out, char const* text) -> Output
+        {
+            for (; *text != '\0'; ++text) {
+                *out++ = *text;
+            }
+            return out;
+        }
+    };
+
+}   // end namespace result_detail
+
+#ifdef __cpp_lib_format
+/**
+ * \brief `std::format` support for results
+ *
+ * \details Specification: `{}`, `{:?}`, `{:ok}`, `{:err}`, `{:ok:value-spec}`, `{:err:value-spec}`
+*/
+template <typename Ok_t, typename Error_t, typename Char>
+struct std::formatter<result<Ok_t, Error_t>, Char> : result_detail::result_formatter<
+    result_detail::value_formatter<Ok_t, std::formatter<Ok_t, Char>>,
+    result_detail::value_formatter<Error_t, std::formatter<Error_t, Char>>,
+    std::format_error
+> {};
+#endif
+
+#ifdef FMT_VERSION
+/**
+ * \brief fmt support for results
+ *
+ * \details Specification: `{}`, `{:?}`, `{:ok}`, `{:err}`, `{:ok:value-spec}`, `{:err:value-spec}`
+*/
+template <typename Ok_t, typename Error_t, typename Char>
+struct fmt::formatter<result<Ok_t, Error_t>, Char> : result_detail::result_formatter<
+    result_detail::value_formatter<Ok_t, fmt::formatter<Ok_t, Char>>,
+    result_detail::value_formatter<Error_t, fmt::formatter<Error_t, Char>>,
+    fmt::format_error
+> {};
+#endif
+
+#endif  // RESULT_FORMAT_H
+
+// MIT License
+//
+// Copyright (c) 2021 Alex Qzminsky
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
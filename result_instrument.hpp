@@ -0,0 +1,257 @@
+#pragma once
+
+// Copyright © 2021 Alex Qzminsky.
+// License: MIT. All rights reserved.
+
+/// \brief Result variant type: per-call-site outcome counters
+///
+/// \details Included by `result.hpp` if `RESULT_INSTRUMENTATION` is defined. Otherwise
+/// the hooks expand to nothing and the counters don't exist
+///
+/// \author https://github.com/qzminsky
+/// \version 0.1.0
+/// \date 2026/10/16
+
+#ifndef RESULT_INSTRUMENT_H
+#define RESULT_INSTRUMENT_H
+
+static_assert(__cplusplus >= 2020'00, "C++20 or higher is required for the instrumentation");
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <source_location>
+#include <string_view>
+#include <vector>
+
+namespace result_instrument
+{
+    /**
+     * \brief Counted outcome
+    */
+    enum class event : std::uint8_t
+    {
+        error_created,      ///< A failure result was constructed by `Error` or `result::error`
+        unwrap_failed,      ///< `unwrap` or `unwrap_error` was called in the other state
+        unwrap_fallback     ///< `unwrap_or` returned the default value
+    };
+
+    inline constexpr auto event_count = std::size_t{ 3 };
+
+    /**
+     * \brief Merged counters of one call site
+    */
+    struct site_stats
+    {
+        std::string_view file;
+        std::string_view function;
+        std::uint32_t line;
+        std::uint32_t column;
+        std::uint64_t counts[event_count];
+
+        /// Returns the counter of the specified event
+        [[nodiscard]]
+        auto operator [] (event ev) const noexcept -> std::uint64_t
+        {
+            return counts[static_cast<std::size_t>(ev)];
+        }
+    };
+
+    namespace detail
+    {
+        /// Counters of one call site in a thread slab. Written by the owning thread only
+        struct slot
+        {
+            std::atomic<char const*> file{ nullptr };
+            char const* function = nullptr;
+            std::uint32_t line = 0;
+            std::uint32_t column = 0;
+            std::atomic<std::uint64_t> counts[event_count] = {};
+        };
+
+        /// Open addressing table of the call sites seen by one thread
+        struct slab
+        {
+            static constexpr std::size_t capacity = 1024;
+            static constexpr std::size_t probes = 16;
+
+            slot slots[capacity];
+
+            /// Counts of events whose site didn't fit into the table
+            std::atomic<std::uint64_t> overflow{ 0 };
+
+            slab ();
+            ~slab ();
+
+            auto add (event ev, std::source_location const& site) noexcept -> void
+            {
+                auto const file = site.file_name();
+                auto hash = reinterpret_cast<std::uintptr_t>(file) ^ (std::uintptr_t{ site.line() } * 0x9e3779b1u) ^ site.column();
+
+                for (auto i = std::size_t{ 0 }; i < probes; ++i, ++hash) {
+                    auto& s = slots[hash % capacity];
+                    auto const owner = s.file.load(std::memory_order_relaxed);
+
+                    if (owner == nullptr) {
+                        s.function = site.function_name();
+                        s.line = site.line();
+                        s.column = site.column();
+                        s.file.store(file, std::memory_order_release);
+                    }
+                    else if (owner != file || s.line != site.line() || s.column != site.column()) {
+                        continue;
+                    }
+
+                    auto& counter = s.counts[static_cast<std::size_t>(ev)];
+                    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                    return;
+                }
+                overflow.store(overflow.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            }
+        };
+
+        /// Registry of the live slabs and the counters of the finished threads
+        struct registry
+        {
+            std::mutex lock;
+            std::vector<slab*> live;
+            std::vector<site_stats> retired;
+            std::uint64_t overflow = 0;
+
+            static auto instance () -> registry&
+            {
+                static registry reg;
+                return reg;
+            }
+
+            /// Adds the site counters to the merged list
+            static auto merge (std::vector<site_stats>& into, site_stats const& stats) -> void
+            {
+                for (auto& known : into) {
+                    if (known.line == stats.line && known.column == stats.column && known.file == stats.file) {
+                        for (auto i = std::size_t{ 0 }; i < event_count; ++i) {
+                            known.counts[i] += stats.counts[i];
+                        }
+                        return;
+                    }
+                }
+                into.push_back(stats);
+            }
+
+            /// Adds the counters of the slab to the merged list
+            static auto merge (std::vector<site_stats>& into, slab const& from) -> void
+            {
+                for (auto const& s : from.slots) {
+                    auto const file = s.file.load(std::memory_order_acquire);
+
+                    if (file == nullptr) continue;
+
+                    auto stats = site_stats{ file, s.function, s.line, s.column, {} };
+
+                    for (auto i = std::size_t{ 0 }; i < event_count; ++i) {
+                        stats.counts[i] = s.counts[i].load(std::memory_order_relaxed);
+                    }
+                    merge(into, stats);
+                }
+            }
+        };
+
+        inline slab::slab ()
+        {
+            auto& reg = registry::instance();
+            std::lock_guard guard{ reg.lock };
+
+            reg.live.push_back(this);
+        }
+
+        inline slab::~slab ()
+        {
+            auto& reg = registry::instance();
+            std::lock_guard guard{ reg.lock };
+
+            registry::merge(reg.retired, *this);
+            reg.overflow += overflow.load(std::memory_order_relaxed);
+            std::erase(reg.live, this);
+        }
+
+        /// Returns the slab of the calling thread
+        inline auto local_slab () -> slab&
+        {
+            thread_local slab local;
+            return local;
+        }
+
+    }   // end namespace detail
+
+    /**
+     * \brief Counts an outcome at the call site
+     *
+     * \param ev Outcome to count
+     * \param site Call site of the result operation
+    */
+    inline auto record (event ev, std::source_location const& site) noexcept -> void
+    {
+        detail::local_slab().add(ev, site);
+    }
+
+    /**
+     * \brief Merges the counters of all the threads, including the finished ones
+     *
+     * \details Concurrent increments may or may not be included
+    */
+    [[nodiscard]]
+    inline auto snapshot () -> std::vector<site_stats>
+    {
+        auto& reg = detail::registry::instance();
+        std::lock_guard guard{ reg.lock };
+
+        auto merged = reg.retired;
+
+        for (auto const* s : reg.live) {
+            detail::registry::merge(merged, *s);
+        }
+        return merged;
+    }
+
+    /**
+     * \brief Returns the number of events dropped because a thread saw too many call sites
+    */
+    [[nodiscard]]
+    inline auto overflow () -> std::uint64_t
+    {
+        auto& reg = detail::registry::instance();
+        std::lock_guard guard{ reg.lock };
+
+        auto total = reg.overflow;
+
+        for (auto const* s : reg.live) {
+            total += s->overflow.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+}   // end namespace result_instrument
+
+#endif  // RESULT_INSTRUMENT_H
+
+// MIT License
+//
+// Copyright (c) 2021 Alex Qzminsky
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
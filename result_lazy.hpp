@@ -0,0 +1,192 @@
+#pragma once
+
+// Copyright © 2021 Alex Qzminsky.
+// License: MIT. All rights reserved.
+
+/// \brief Result variant type: lazy initialization extension
+///
+/// \author https://github.com/qzminsky
+/// \version 0.1.0
+/// \date 2026/10/16
+
+#ifndef RESULT_LAZY_H
+#define RESULT_LAZY_H
+
+static_assert(__cplusplus >= 2017'00, "C++17 or higher is required");
+
+#include "result.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <optional>
+
+/**
+ * \class lazy_result
+ *
+ * \brief Value computed on the first access by a result-returning functor
+ *
+ * \details Unlike `std::call_once`, a failure doesn't poison the initialization. A success is
+ * cached forever and read with a single acquire load. A failure is cached for the configured
+ * time, then the next access retries. Only one thread invokes the functor at a time; the
+ * threads that were waiting for an attempt get its outcome instead of starting their own
+*/
+template <typename Functor>
+class lazy_result
+{
+public:
+
+    // ANCHOR Member types
+    using functor_type = Functor;
+    using result_type  = std::invoke_result_t<Functor&>;
+    using clock_type   = std::chrono::steady_clock;
+
+    static_assert(result_detail::is_result_v<result_type>, "The lazy functor must return a result");
+
+    using value_type = typename result_type::ok_type;
+    using error_type = typename result_type::error_type;
+
+    /// Result of an access: the address of the cached value, or the error of the last attempt
+    using access_type = result<value_type const*, error_type>;
+
+private:
+
+    std::atomic<bool> _ready{ false };
+    alignas(value_type) unsigned char _value[sizeof(value_type)];
+
+    functor_type _func;
+    clock_type::duration _error_ttl;
+
+    // Slow path state, guarded by the lock; attempts are also read before locking
+    std::mutex _lock;
+    std::atomic<std::uint64_t> _attempts{ 0 };
+    std::optional<error_type> _error;
+    clock_type::time_point _error_expires;
+
+public:
+
+    /**
+     * \brief Constructs an uncomputed value
+     *
+     * \param func Result-returning functor computing the value
+     * \param error_ttl Time a failure is returned to the new callers before the next retry;
+     * zero retries on every access
+    */
+    explicit lazy_result (functor_type func, clock_type::duration error_ttl = clock_type::duration::zero())
+        : _func{ std::move(func) }
+        , _error_ttl{ error_ttl }
+    {}
+
+    lazy_result (lazy_result const&) = delete;
+    auto operator = (lazy_result const&) -> lazy_result& = delete;
+
+    ~lazy_result ()
+    {
+        if (_ready.load(std::memory_order_acquire)) {
+            _get()->~value_type();
+        }
+    }
+
+    /**
+     * \brief Returns the computed value, computing it if needed
+     *
+     * \return Address of the value, which lives as long as the object, or a copy of the error
+     *
+     * \throw Any exception thrown by the functor; exceptions are not cached
+    */
+    auto get () -> access_type
+    {
+        if (_ready.load(std::memory_order_acquire)) {
+            return access_type{ std::in_place_index<0>, _get() };
+        }
+        return _compute();
+    }
+
+    /**
+     * \brief Returns `true` if the value is computed
+    */
+    [[nodiscard]]
+    auto is_ready () const noexcept -> bool
+    {
+        return _ready.load(std::memory_order_acquire);
+    }
+
+    /**
+     * \brief Drops the cached failure, so the next access retries immediately
+    */
+    auto forget_error () -> void
+    {
+        std::lock_guard guard{ _lock };
+        _error.reset();
+    }
+
+private:
+
+    auto _get () const noexcept -> value_type const*
+    {
+        return std::launder(reinterpret_cast<value_type const*>(_value));
+    }
+
+    // Slow path: invokes the functor unless the value or a fresh failure is already there
+    auto _compute () -> access_type
+    {
+        auto const seen = _attempts.load(std::memory_order_relaxed);
+
+        std::lock_guard guard{ _lock };
+
+        if (_ready.load(std::memory_order_relaxed)) {
+            return access_type{ std::in_place_index<0>, _get() };
+        }
+
+        // An attempt that finished while this thread was waiting answers it as well
+        if (_error && (_attempts.load(std::memory_order_relaxed) != seen || clock_type::now() < _error_expires)) {
+            return access_type{ std::in_place_index<1>, *_error };
+        }
+
+        auto res = std::invoke(_func);
+
+        _attempts.fetch_add(1, std::memory_order_relaxed);
+
+        if (res.is_ok()) {
+            ::new (static_cast<void*>(_value)) value_type(std::move(res).unwrap_unchecked());
+
+            _error.reset();
+            _ready.store(true, std::memory_order_release);
+
+            return access_type{ std::in_place_index<0>, _get() };
+        }
+
+        _error.emplace(std::move(res).unwrap_error_unchecked());
+        _error_expires = clock_type::now() + _error_ttl;
+
+        return access_type{ std::in_place_index<1>, *_error };
+    }
+
+};  // end class lazy_result
+
+#endif  // RESULT_LAZY_H
+
+// MIT License
+//
+// Copyright (c) 2021 Alex Qzminsky
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
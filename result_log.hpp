@@ -0,0 +1,634 @@
+#pragma once
+
+// Copyright © 2021 Alex Qzminsky.
+// License: MIT. All rights reserved.
+
+/// \brief Result variant type: memory-mapped log extension
+///
+/// \details Log file layout: a file header followed by blocks of encoded results. A block collects
+/// at least `log_block_header::min_size` bytes of records, so its header is followed by many pages
+/// of records. The header holds the records and failures counts and is followed by a failure bitmap
+/// and the record offsets, so failures are counted and located without reading the records.
+/// Records use the `result_serialize.hpp` encoding. POSIX only
+///
+/// \author https://github.com/qzminsky
+/// \version 0.1.0
+/// \date 2026/10/16
+
+#ifndef RESULT_LOG_H
+#define RESULT_LOG_H
+
+static_assert(__cplusplus >= 2017'00, "C++17 or higher is required");
+
+#include "result_serialize.hpp"
+#include "result_sys.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if __has_include(<sys/mman.h>)
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#else
+#   error "result_log.hpp requires POSIX memory mapping"
+#endif
+
+/**
+ * \brief Header of a log file
+*/
+struct log_file_header
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t block_size;
+};
+
+/**
+ * \brief Header of a log block
+ *
+ * \details The header is followed by `(count + 63) / 64` words of the failure bitmap, `count` record
+ * offsets and the records, each part padded to 8 bytes. Bit `i % 64` of the word `i / 64` is set
+ * if the record `i` is a failure; offsets are counted from the first record
+*/
+struct log_block_header
+{
+    /// Number of record bytes a block collects before it's written, unless flushed earlier
+    static constexpr std::uint32_t min_size = 64 * 1024;
+
+    /// Number of records in the block
+    std::uint32_t count;
+
+    /// Number of failures in the block
+    std::uint32_t errors;
+
+    /// Number of bytes following the header: the bitmap, the offsets and the records
+    std::uint64_t size;
+};
+
+namespace result_detail
+{
+    inline constexpr char log_magic[8] = { 'R', 'E', 'S', 'L', 'O', 'G', '\0', '\0' };
+    inline constexpr std::uint32_t log_version = 3;
+
+    /// Returns the size of the failure bitmap of a block, in words
+    inline constexpr auto log_bitmap_words (std::uint64_t count) noexcept -> std::uint64_t
+    {
+        return (count + 63) / 64;
+    }
+
+    /// Returns the size of the record offsets of a block, in bytes, including the alignment padding
+    inline constexpr auto log_offsets_size (std::uint64_t count) noexcept -> std::uint64_t
+    {
+        return (count * sizeof(std::uint32_t) + 7) & ~std::uint64_t{ 7 };
+    }
+
+    /// Returns the index of the n-th (from zero) set bit
+    inline auto select_bit (std::uint64_t bits, std::uint32_t n) noexcept -> std::uint32_t
+    {
+        for (; n != 0; --n) {
+            bits &= bits - 1;
+        }
+        auto index = std::uint32_t{ 0 };
+
+        for (; (bits & 1) == 0; bits >>= 1) {
+            ++index;
+        }
+        return index;
+    }
+
+    /// Counts the set bits
+    inline auto count_bits (std::uint64_t bits) noexcept -> std::uint32_t
+    {
+        auto count = std::uint32_t{ 0 };
+
+        for (; bits != 0; bits &= bits - 1) {
+            ++count;
+        }
+        return count;
+    }
+
+    /// Writes the whole buffer, retrying partial and interrupted writes
+    inline auto write_all (int fd, void const* data, std::size_t size) -> sys_result<result_monostate>
+    {
+        auto const* bytes = static_cast<std::byte const*>(data);
+
+        while (size != 0) {
+            auto written = sys_call<sys_eintr::retry>(::write, fd, bytes, size);
+
+            if (written.is_error()) {
+                return sys_result<result_monostate>{ std::in_place_index<1>, written.unwrap_error_unchecked() };
+            }
+            bytes += written.unwrap_unchecked();
+            size -= static_cast<std::size_t>(written.unwrap_unchecked());
+        }
+        return sys_result<result_monostate>{ std::in_place_index<0> };
+    }
+
+}   // end namespace result_detail
+
+/**
+ * \class result_log_writer
+ *
+ * \brief Appends results to a log file
+ *
+ * \details Records are collected in memory and written by whole blocks of at least
+ * `log_block_header::min_size` bytes. A block that isn't flushed is lost if the process dies;
+ * the readers ignore a partially written last block. A block written partially by a failed flush
+ * is cut off by truncating the file to its size before the write, which assumes no other writer
+ * appended meanwhile
+*/
+template <typename Ok_t, typename Error_t>
+class result_log_writer
+{
+public:
+
+    // ANCHOR Member types
+    using result_type = result<Ok_t, Error_t>;
+
+private:
+
+    int _fd = -1;
+    log_block_header _header = {};
+
+    std::vector<std::uint64_t> _failed;
+    std::vector<std::uint32_t> _offsets;
+    std::vector<std::byte> _records;
+
+    // A block was written partially and couldn't be cut off
+    bool _torn = false;
+
+    explicit result_log_writer (int fd) noexcept : _fd{ fd } {}
+
+public:
+
+    result_log_writer (result_log_writer&& other) noexcept
+        : _fd{ std::exchange(other._fd, -1) }
+        , _header{ other._header }
+        , _failed{ std::move(other._failed) }
+        , _offsets{ std::move(other._offsets) }
+        , _records{ std::move(other._records) }
+        , _torn{ other._torn }
+    {}
+
+    result_log_writer (result_log_writer const&) = delete;
+    auto operator = (result_log_writer const&) -> result_log_writer& = delete;
+    auto operator = (result_log_writer&&) -> result_log_writer& = delete;
+
+    /// Flushes the collected records and closes the file; errors are ignored
+    ~result_log_writer ()
+    {
+        if (_fd != -1) {
+            (void)flush();
+            ::close(_fd);
+        }
+    }
+
+    /**
+     * \brief Opens a log file for appending, creating it if needed
+     *
+     * \param path Path to the log file
+     *
+     * \return Writer or the error code; `std::errc::illegal_byte_sequence` if the file isn't a log
+    */
+    [[nodiscard]]
+    static auto open (char const* path) -> sys_result<result_log_writer>
+    {
+        using opened = sys_result<result_log_writer>;
+
+        auto fd = sys_call<sys_eintr::retry>(::open, path, O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+
+        if (fd.is_error()) {
+            return opened{ std::in_place_index<1>, fd.unwrap_error_unchecked() };
+        }
+        auto writer = result_log_writer{ fd.unwrap_unchecked() };
+        auto header = log_file_header{};
+
+        auto got = sys_call<sys_eintr::retry>(::pread, writer._fd, &header, sizeof header, off_t{ 0 });
+
+        if (got.is_error()) {
+            return opened{ std::in_place_index<1>, got.unwrap_error_unchecked() };
+        }
+        if (got.unwrap_unchecked() == 0) {
+            std::memcpy(header.magic, result_detail::log_magic, sizeof header.magic);
+            header.version = result_detail::log_version;
+            header.block_size = log_block_header::min_size;
+
+            if (auto res = result_detail::write_all(writer._fd, &header, sizeof header); res.is_error()) {
+                return opened{ std::in_place_index<1>, res.unwrap_error_unchecked() };
+            }
+        }
+        else if (got.unwrap_unchecked() != sizeof header ||
+                 std::memcmp(header.magic, result_detail::log_magic, sizeof header.magic) != 0 ||
+                 header.version != result_detail::log_version)
+        {
+            return opened{ std::in_place_index<1>, std::errc::illegal_byte_sequence };
+        }
+        return opened{ std::in_place_index<0>, std::move(writer) };
+    }
+
+    /**
+     * \brief Appends the result; a full block is written to the file
+     *
+     * \param res Result to append
+     *
+     * \return Error of the block write; the result stays collected then, see `flush`
+    */
+    auto append (result_type const& res) -> sys_result<result_monostate>
+    {
+        if (_header.count % 64 == 0) {
+            _failed.push_back(0);
+        }
+        _failed.back() |= std::uint64_t{ res.is_error() } << (_header.count % 64);
+        _offsets.push_back(static_cast<std::uint32_t>(_records.size()));
+        _header.errors += res.is_error();
+        ++_header.count;
+
+        serialize(res, _records);
+
+        if (_records.size() >= log_block_header::min_size) {
+            return flush();
+        }
+        return sys_result<result_monostate>{ std::in_place_index<0> };
+    }
+
+    /**
+     * \brief Writes the collected records as a block, even if it's not full
+     *
+     * \details If the write fails, the records are kept for the next flush and the partially
+     * written block is cut off the file. If it can't be cut off, the writer refuses further writes
+     * with `std::errc::io_error`
+    */
+    auto flush () -> sys_result<result_monostate>
+    {
+        using flushed = sys_result<result_monostate>;
+
+        if (_torn) {
+            return flushed{ std::in_place_index<1>, std::errc::io_error };
+        }
+        if (_header.count == 0) {
+            return flushed{ std::in_place_index<0> };
+        }
+        auto const bitmap_size = _failed.size() * sizeof(std::uint64_t);
+        auto const offsets_size = result_detail::log_offsets_size(_header.count);
+        auto const records_size = (_records.size() + 7) & ~std::size_t{ 7 };
+
+        auto header = _header;
+        header.size = bitmap_size + offsets_size + records_size;
+
+        // Header and records go in one write, so a block is never split by another writer.
+        // The block is zero-filled, which pads the records
+        auto block = std::vector<std::byte>(sizeof header + header.size);
+        auto* out = block.data();
+
+        std::memcpy(out, &header, sizeof header);
+        std::memcpy(out += sizeof header, _failed.data(), bitmap_size);
+        std::memcpy(out += bitmap_size, _offsets.data(), _offsets.size() * sizeof(std::uint32_t));
+        std::memcpy(out + offsets_size, _records.data(), _records.size());
+
+        auto const end = sys_call<sys_eintr::retry>(::lseek, _fd, off_t{ 0 }, SEEK_END);
+
+        if (end.is_error()) {
+            return flushed{ std::in_place_index<1>, end.unwrap_error_unchecked() };
+        }
+        if (auto res = result_detail::write_all(_fd, block.data(), block.size()); res.is_error()) {
+            _torn = sys_call<sys_eintr::retry>(::ftruncate, _fd, end.unwrap_unchecked()).is_error();
+            return res;
+        }
+
+        _header = {};
+        _failed.clear();
+        _offsets.clear();
+        _records.clear();
+
+        return flushed{ std::in_place_index<0> };
+    }
+
+};  // end class result_log_writer
+
+/**
+ * \class result_log_reader
+ *
+ * \brief Read-only memory mapping of a log file
+ *
+ * \details Only block headers and failure bitmaps are read when the log is opened, counted or
+ * searched for failures; the pages of the records are touched when a view is decoded. Views
+ * borrow from the mapping and are valid while the reader lives
+*/
+template <typename Ok_t, typename Error_t>
+class result_log_reader
+{
+public:
+
+    // ANCHOR Member types
+    using view_type = result_view<Ok_t, Error_t>;
+
+private:
+
+    std::byte const* _map = nullptr;
+    std::size_t _length = 0;
+
+    std::vector<log_block_header const*> _blocks;
+
+    // Numbers of records and failures before each block, with the totals at the end
+    std::vector<std::uint64_t> _records_before;
+    std::vector<std::uint64_t> _errors_before;
+
+    result_log_reader () = default;
+
+public:
+
+    result_log_reader (result_log_reader&& other) noexcept
+        : _map{ std::exchange(other._map, nullptr) }
+        , _length{ other._length }
+        , _blocks{ std::move(other._blocks) }
+        , _records_before{ std::move(other._records_before) }
+        , _errors_before{ std::move(other._errors_before) }
+    {}
+
+    result_log_reader (result_log_reader const&) = delete;
+    auto operator = (result_log_reader const&) -> result_log_reader& = delete;
+    auto operator = (result_log_reader&&) -> result_log_reader& = delete;
+
+    ~result_log_reader ()
+    {
+        if (_map) ::munmap(const_cast<std::byte*>(_map), _length);
+    }
+
+    /**
+     * \brief Maps a log file and indexes its blocks
+     *
+     * \param path Path to the log file
+     *
+     * \return Reader or the error code; `std::errc::illegal_byte_sequence` if the file isn't a log
+    */
+    [[nodiscard]]
+    static auto open (char const* path) -> sys_result<result_log_reader>
+    {
+        using opened = sys_result<result_log_reader>;
+
+        auto fd = sys_call<sys_eintr::retry>(::open, path, O_RDONLY | O_CLOEXEC);
+
+        if (fd.is_error()) {
+            return opened{ std::in_place_index<1>, fd.unwrap_error_unchecked() };
+        }
+
+        struct stat info;
+        auto const stated = sys_call(::fstat, fd.unwrap_unchecked(), &info);
+
+        if (stated.is_error()) {
+            ::close(fd.unwrap_unchecked());
+            return opened{ std::in_place_index<1>, stated.unwrap_error_unchecked() };
+        }
+        if (static_cast<std::size_t>(info.st_size) < sizeof(log_file_header)) {
+            ::close(fd.unwrap_unchecked());
+            return opened{ std::in_place_index<1>, std::errc::illegal_byte_sequence };
+        }
+
+        auto reader = result_log_reader{};
+        auto const length = static_cast<std::size_t>(info.st_size);
+        auto* map = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, fd.unwrap_unchecked(), 0);
+        auto const error = errno;
+
+        ::close(fd.unwrap_unchecked());
+
+        if (map == MAP_FAILED) {
+            return opened{ std::in_place_index<1>, static_cast<std::errc>(error) };
+        }
+        reader._map = static_cast<std::byte const*>(map);
+        reader._length = length;
+
+        if (!reader._index()) {
+            return opened{ std::in_place_index<1>, std::errc::illegal_byte_sequence };
+        }
+        return opened{ std::in_place_index<0>, std::move(reader) };
+    }
+
+    /**
+     * \brief Returns the number of records
+    */
+    [[nodiscard]]
+    auto size () const noexcept -> std::uint64_t
+    {
+        return _records_before.back();
+    }
+
+    /**
+     * \brief Returns the number of failure records; only block headers are read
+    */
+    [[nodiscard]]
+    auto error_count () const noexcept -> std::uint64_t
+    {
+        return _errors_before.back();
+    }
+
+    /**
+     * \brief Returns a view of the record
+     *
+     * \param index Record index
+     *
+     * \return View, `std::errc::result_out_of_range` or `std::errc::illegal_byte_sequence` if the record is corrupted
+    */
+    [[nodiscard]]
+    auto at (std::uint64_t index) const -> sys_result<view_type>
+    {
+        if (index >= size()) {
+            return sys_result<view_type>{ std::in_place_index<1>, std::errc::result_out_of_range };
+        }
+        auto const block = static_cast<std::size_t>(
+            std::upper_bound(_records_before.begin(), _records_before.end(), index) - _records_before.begin() - 1
+        );
+        return _view(block, static_cast<std::uint32_t>(index - _records_before[block]));
+    }
+
+    /**
+     * \brief Returns a view of the n-th (from zero) failure record; blocks before it are skipped by their headers
+     *
+     * \param n Failure index
+     *
+     * \return View, `std::errc::result_out_of_range` or `std::errc::illegal_byte_sequence` if the record is corrupted
+    */
+    [[nodiscard]]
+    auto nth_error (std::uint64_t n) const -> sys_result<view_type>
+    {
+        if (n >= error_count()) {
+            return sys_result<view_type>{ std::in_place_index<1>, std::errc::result_out_of_range };
+        }
+        auto const block = static_cast<std::size_t>(
+            std::upper_bound(_errors_before.begin(), _errors_before.end(), n) - _errors_before.begin() - 1
+        );
+        auto const* bitmap = _bitmap(block);
+        auto rank = static_cast<std::uint32_t>(n - _errors_before[block]);
+        auto word = std::uint32_t{ 0 };
+
+        for (; rank >= result_detail::count_bits(bitmap[word]); ++word) {
+            rank -= result_detail::count_bits(bitmap[word]);
+        }
+        auto const record = word * 64 + result_detail::select_bit(bitmap[word], rank);
+
+        return _view(block, record);
+    }
+
+    /**
+     * \brief Invokes the functor with a view of each failure record; blocks without failures are skipped
+     *
+     * \param func Functor taking `view_type const&`
+     *
+     * \return Nothing or `std::errc::illegal_byte_sequence` if a record is corrupted; the iteration stops at it
+    */
+    template <typename Functor>
+    auto for_each_error (Functor&& func) const -> sys_result<result_monostate>
+    {
+        for (auto block = std::size_t{ 0 }; block < _blocks.size(); ++block) {
+            if (_blocks[block]->errors == 0) continue;
+
+            auto const* bitmap = _bitmap(block);
+
+            for (auto word = std::uint32_t{ 0 }; word < result_detail::log_bitmap_words(_blocks[block]->count); ++word) {
+                for (auto bits = bitmap[word]; bits != 0; bits &= bits - 1) {
+                    auto const view = _view(block, word * 64 + result_detail::select_bit(bits, 0));
+
+                    if (view.is_error()) {
+                        return sys_result<result_monostate>{ std::in_place_index<1>, view.unwrap_error_unchecked() };
+                    }
+                    func(view.unwrap_unchecked());
+                }
+            }
+        }
+        return sys_result<result_monostate>{ std::in_place_index<0> };
+    }
+
+    /**
+     * \brief Invokes the functor with a view of each record
+     *
+     * \param func Functor taking `view_type const&`
+     *
+     * \return Nothing or `std::errc::illegal_byte_sequence` if a record is corrupted; the iteration stops at it
+    */
+    template <typename Functor>
+    auto for_each (Functor&& func) const -> sys_result<result_monostate>
+    {
+        for (auto block = std::size_t{ 0 }; block < _blocks.size(); ++block) {
+            for (auto record = std::uint32_t{ 0 }; record < _blocks[block]->count; ++record) {
+                auto const view = _view(block, record);
+
+                if (view.is_error()) {
+                    return sys_result<result_monostate>{ std::in_place_index<1>, view.unwrap_error_unchecked() };
+                }
+                func(view.unwrap_unchecked());
+            }
+        }
+        return sys_result<result_monostate>{ std::in_place_index<0> };
+    }
+
+private:
+
+    // Validates the file header and collects the complete blocks
+    auto _index () -> bool
+    {
+        auto header = log_file_header{};
+        std::memcpy(&header, _map, sizeof header);
+
+        if (std::memcmp(header.magic, result_detail::log_magic, sizeof header.magic) != 0 ||
+            header.version != result_detail::log_version)
+        {
+            return false;
+        }
+
+        auto offset = sizeof header;
+        auto records = std::uint64_t{ 0 }, errors = std::uint64_t{ 0 };
+
+        while (offset + sizeof(log_block_header) <= _length) {
+            auto const* block = reinterpret_cast<log_block_header const*>(_map + offset);
+
+            if (block->size > _length - offset - sizeof(log_block_header)) break;     // partially written
+
+            auto const words = result_detail::log_bitmap_words(block->count);
+
+            if (words * sizeof(std::uint64_t) + result_detail::log_offsets_size(block->count) > block->size) {
+                return false;
+            }
+            _blocks.push_back(block);
+
+            auto errors_in_block = std::uint64_t{ 0 };
+
+            for (auto word = std::uint64_t{ 0 }; word < words; ++word) {
+                errors_in_block += result_detail::count_bits(_bitmap(_blocks.size() - 1)[word]);
+            }
+            if (errors_in_block != block->errors) {
+                return false;
+            }
+            _records_before.push_back(records);
+            _errors_before.push_back(errors);
+
+            records += block->count;
+            errors += block->errors;
+            offset += sizeof(log_block_header) + block->size;
+        }
+        _records_before.push_back(records);
+        _errors_before.push_back(errors);
+
+        return true;
+    }
+
+    // Returns the failure bitmap of the block
+    auto _bitmap (std::size_t block) const noexcept -> std::uint64_t const*
+    {
+        return reinterpret_cast<std::uint64_t const*>(_blocks[block] + 1);
+    }
+
+    // Returns the record offsets of the block
+    auto _offsets (std::size_t block) const noexcept -> std::uint32_t const*
+    {
+        return reinterpret_cast<std::uint32_t const*>(_bitmap(block) + result_detail::log_bitmap_words(_blocks[block]->count));
+    }
+
+    // Returns a view of the record of the block or `std::errc::illegal_byte_sequence` if it's corrupted
+    auto _view (std::size_t block, std::uint32_t record) const -> sys_result<view_type>
+    {
+        auto const* header = _blocks[block];
+        auto const* data = reinterpret_cast<std::byte const*>(_offsets(block)) + result_detail::log_offsets_size(header->count);
+        auto const size = header->size
+                        - result_detail::log_bitmap_words(header->count) * sizeof(std::uint64_t)
+                        - result_detail::log_offsets_size(header->count);
+        auto const offset = _offsets(block)[record];
+
+        if (offset >= size) {
+            return sys_result<view_type>{ std::in_place_index<1>, std::errc::illegal_byte_sequence };
+        }
+        auto view = view_type::parse(data + offset, size - offset);
+
+        if (view.is_error()) {
+            return sys_result<view_type>{ std::in_place_index<1>, std::errc::illegal_byte_sequence };
+        }
+        return sys_result<view_type>{ std::in_place_index<0>, view.unwrap_unchecked() };
+    }
+
+};  // end class result_log_reader
+
+#endif  // RESULT_LOG_H
+
+// MIT License
+//
+// Copyright (c) 2021 Alex Qzminsky
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
@@ -0,0 +1,366 @@
+#pragma once
+
+// Copyright © 2021 Alex Qzminsky.
+// License: MIT. All rights reserved.
+
+/// \brief Result variant type: memoization extension
+///
+/// \author https://github.com/qzminsky
+/// \version 0.1.0
+/// \date 2026/10/16
+
+#ifndef RESULT_MEMO_H
+#define RESULT_MEMO_H
+
+static_assert(__cplusplus >= 2017'00, "C++17 or higher is required");
+
+#include "result.hpp"
+
+#include <chrono>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+
+/**
+ * \brief Capacity and expiry policy of the cached results of one state
+*/
+struct memo_policy
+{
+    /// Maximal number of cached results; `0` disables caching
+    std::size_t capacity = 1024;
+
+    /// Time the cached result stays valid
+    std::chrono::steady_clock::duration ttl = std::chrono::minutes{ 10 };
+};
+
+/**
+ * \brief Memoization options
+*/
+struct memo_options
+{
+    /// Policy for success results
+    memo_policy ok = { 1024, std::chrono::minutes{ 10 } };
+
+    /// Policy for failure results
+    memo_policy error = { 128, std::chrono::seconds{ 5 } };
+
+    /// Number of independently locked map shards
+    std::size_t shards = 16;
+};
+
+namespace result_detail
+{
+    /// Owning key element that stores an argument of type `T` in the cache
+    template <typename T>
+    struct memo_key
+    {
+        using type = T;
+
+        static auto arg (type const& key) -> T const& { return key; }
+    };
+
+    /// Copies the viewed characters, so the cached key doesn't outlive them
+    template <typename Char_t, typename Traits_t>
+    struct memo_key<std::basic_string_view<Char_t, Traits_t>>
+    {
+        using type = std::basic_string<Char_t, Traits_t>;
+
+        static auto arg (type const& key) -> std::basic_string_view<Char_t, Traits_t> { return key; }
+    };
+
+    template <typename Char_t>
+    struct memo_c_string_key
+    {
+        using type = std::basic_string<Char_t>;
+
+        static auto arg (type const& key) -> Char_t const* { return key.c_str(); }
+    };
+
+    template <> struct memo_key<char const*> : memo_c_string_key<char> {};
+    template <> struct memo_key<wchar_t const*> : memo_c_string_key<wchar_t> {};
+    template <> struct memo_key<char16_t const*> : memo_c_string_key<char16_t> {};
+    template <> struct memo_key<char32_t const*> : memo_c_string_key<char32_t> {};
+#ifdef __cpp_char8_t
+    template <> struct memo_key<char8_t const*> : memo_c_string_key<char8_t> {};
+#endif
+
+    /// Deduces the result and the arguments types of a functor
+    template <typename Functor>
+    struct memo_signature : memo_signature<decltype(&Functor::operator())> {};
+
+    template <typename Ret, typename... Args>
+    struct memo_signature<Ret (*) (Args...)>
+    {
+        using result_type = Ret;
+        using key_type    = std::tuple<typename memo_key<std::decay_t<Args>>::type...>;
+        using args_type   = std::tuple<std::decay_t<Args>...>;
+    };
+
+    template <typename Ret, typename... Args>
+    struct memo_signature<Ret (*) (Args...) noexcept> : memo_signature<Ret (*) (Args...)> {};
+
+    template <typename Class, typename Ret, typename... Args>
+    struct memo_signature<Ret (Class::*) (Args...)> : memo_signature<Ret (*) (Args...)> {};
+
+    template <typename Class, typename Ret, typename... Args>
+    struct memo_signature<Ret (Class::*) (Args...) const> : memo_signature<Ret (*) (Args...)> {};
+
+    template <typename Class, typename Ret, typename... Args>
+    struct memo_signature<Ret (Class::*) (Args...) noexcept> : memo_signature<Ret (*) (Args...)> {};
+
+    template <typename Class, typename Ret, typename... Args>
+    struct memo_signature<Ret (Class::*) (Args...) const noexcept> : memo_signature<Ret (*) (Args...)> {};
+
+    /// Hashes an arguments tuple by combining the hashes of its elements
+    struct tuple_hash
+    {
+        template <typename... Args>
+        auto operator () (std::tuple<Args...> const& key) const -> std::size_t
+        {
+            return std::apply([](auto const&... args) {
+                auto seed = std::size_t{ 0 };
+                ((seed ^= std::hash<std::decay_t<decltype(args)>>{}(args)
+                        + static_cast<std::size_t>(0x9e3779b97f4a7c15ull) + (seed << 6) + (seed >> 2)), ...);
+                return seed;
+            }, key);
+        }
+    };
+
+    /// Invokes the functor with the arguments viewed from the cached key
+    template <typename Args_t, typename Functor, typename Key_t, std::size_t... I>
+    auto memo_invoke (Functor& func, Key_t const& key, std::index_sequence<I...>) -> decltype(auto)
+    {
+        return std::invoke(func, memo_key<std::tuple_element_t<I, Args_t>>::arg(std::get<I>(key))...);
+    }
+
+}   // end namespace result_detail
+
+/**
+ * \class memoized
+ *
+ * \brief Caching wrapper of a result-returning functor
+ *
+ * \details Caches results keyed by the arguments tuple. String views and C strings are copied
+ * into owning strings, so a cached key never refers to the caller's buffer. Success and failure results have
+ * separate capacity and expiry policies; the oldest result of the same state is evicted
+ * when a shard is full. The cache is split into shards guarded by reader-writer locks, so
+ * concurrent hits don't contend. Concurrent misses on the same key are deduplicated: only
+ * one of the callers invokes the functor, the others wait for its result
+*/
+template <typename Functor>
+class memoized
+{
+public:
+
+    // ANCHOR Member types
+    using functor_type = Functor;
+    using result_type  = typename result_detail::memo_signature<Functor>::result_type;
+    using key_type     = typename result_detail::memo_signature<Functor>::key_type;
+    using args_type    = typename result_detail::memo_signature<Functor>::args_type;
+    using clock_type   = std::chrono::steady_clock;
+
+    static_assert(result_detail::is_result_v<result_type>, "The memoized functor must return a result");
+
+private:
+
+    // Cached result with its expiry time and position in the eviction order
+    struct entry
+    {
+        result_type value;
+        clock_type::time_point expires;
+        typename std::list<key_type const*>::iterator order;
+    };
+
+    // Call in progress shared between the deduplicated callers
+    using flight = std::shared_future<result_type>;
+
+    struct alignas(64) shard
+    {
+        std::shared_mutex lock;
+        std::unordered_map<key_type, entry, result_detail::tuple_hash> entries;
+        std::unordered_map<key_type, flight, result_detail::tuple_hash> flights;
+
+        // Insertion order of the cached keys by state: success, failure
+        std::list<key_type const*> order[2];
+    };
+
+    functor_type _func;
+    memo_options _options;
+    std::unique_ptr<shard[]> _shards;
+
+public:
+
+    /**
+     * \brief Constructs a memoizing wrapper
+     *
+     * \param func Result-returning functor to memoize
+     * \param options Caching options
+    */
+    explicit memoized (functor_type func, memo_options const& options = {})
+        : _func{ std::move(func) }
+        , _options{ options }
+        , _shards{ std::make_unique<shard[]>(options.shards ? options.shards : 1) }
+    {
+        if (_options.shards == 0) {
+            _options.shards = 1;
+        }
+    }
+
+    /**
+     * \brief Returns a cached result for the arguments or invokes the functor
+     *
+     * \param args Arguments of the memoized functor
+     *
+     * \throw Any exception thrown by the functor; exceptions are not cached
+    */
+    template <typename... Args>
+    auto operator () (Args&&... args) -> result_type
+    {
+        auto key = key_type{ std::forward<Args>(args)... };
+        auto& sh = _shards[result_detail::tuple_hash{}(key) % _options.shards];
+
+        {
+            std::shared_lock guard{ sh.lock };
+
+            if (auto it = sh.entries.find(key); it != sh.entries.end() && clock_type::now() < it->second.expires) {
+                return it->second.value;
+            }
+        }
+
+        std::promise<result_type> promise;
+        {
+            std::unique_lock guard{ sh.lock };
+
+            if (auto it = sh.entries.find(key); it != sh.entries.end()) {
+                if (clock_type::now() < it->second.expires) {
+                    return it->second.value;
+                }
+                _erase(sh, it);
+            }
+            if (auto it = sh.flights.find(key); it != sh.flights.end()) {
+                auto pending = it->second;
+
+                guard.unlock();
+                return pending.get();
+            }
+            sh.flights.emplace(key, promise.get_future().share());
+        }
+
+        try {
+            auto res = result_detail::memo_invoke<args_type>(
+                _func, key, std::make_index_sequence<std::tuple_size_v<key_type>>{}
+            );
+            {
+                std::unique_lock guard{ sh.lock };
+
+                _insert(sh, key, res);
+                sh.flights.erase(key);
+            }
+            promise.set_value(res);
+
+            return res;
+        }
+        catch (...) {
+            {
+                std::unique_lock guard{ sh.lock };
+                sh.flights.erase(key);
+            }
+            promise.set_exception(std::current_exception());
+            throw;
+        }
+    }
+
+    /**
+     * \brief Drops the cached result for the arguments
+     *
+     * \param args Arguments of the memoized functor
+    */
+    template <typename... Args>
+    auto invalidate (Args&&... args) -> void
+    {
+        auto key = key_type{ std::forward<Args>(args)... };
+        auto& sh = _shards[result_detail::tuple_hash{}(key) % _options.shards];
+
+        std::unique_lock guard{ sh.lock };
+
+        if (auto it = sh.entries.find(key); it != sh.entries.end()) {
+            _erase(sh, it);
+        }
+    }
+
+    /**
+     * \brief Drops all the cached results
+    */
+    auto clear () -> void
+    {
+        for (auto i = std::size_t{ 0 }; i < _options.shards; ++i) {
+            std::unique_lock guard{ _shards[i].lock };
+
+            _shards[i].entries.clear();
+            _shards[i].order[0].clear();
+            _shards[i].order[1].clear();
+        }
+    }
+
+private:
+
+    // Removes the cached entry with its eviction order position
+    auto _erase (shard& sh, typename decltype(shard::entries)::iterator it) -> void
+    {
+        sh.order[it->second.value.is_error()].erase(it->second.order);
+        sh.entries.erase(it);
+    }
+
+    // Caches the result evicting the oldest one of the same state if the shard is full
+    auto _insert (shard& sh, key_type const& key, result_type const& res) -> void
+    {
+        auto const& policy = res.is_ok() ? _options.ok : _options.error;
+        auto const capacity = (policy.capacity + _options.shards - 1) / _options.shards;
+
+        if (capacity == 0 || policy.ttl <= clock_type::duration::zero()) return;
+
+        auto& order = sh.order[res.is_error()];
+
+        if (auto it = sh.entries.find(key); it != sh.entries.end()) {
+            _erase(sh, it);
+        }
+        if (order.size() >= capacity) {
+            _erase(sh, sh.entries.find(*order.front()));
+        }
+
+        auto [it, _] = sh.entries.emplace(key, entry{ res, clock_type::now() + policy.ttl, {} });
+        it->second.order = order.insert(order.end(), &it->first);
+    }
+
+};  // end class memoized
+
+#endif  // RESULT_MEMO_H
+
+// MIT License
+//
+// Copyright (c) 2021 Alex Qzminsky
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
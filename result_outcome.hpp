@@ -0,0 +1,484 @@
+#pragma once
+
+// Copyright © 2021 Alex Qzminsky.
+// License: MIT. All rights reserved.
+
+/// \brief Result variant type: outcome with warnings extension
+///
+/// \author https://github.com/qzminsky
+/// \version 0.1.0
+/// \date 2026/10/16
+
+#ifndef RESULT_OUTCOME_H
+#define RESULT_OUTCOME_H
+
+static_assert(__cplusplus >= 2017'00, "C++17 or higher is required");
+
+#include "result.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace result_detail
+{
+    /// Inline part of `outcome_warnings`: the buffer and the number of warnings in it
+    template <typename Warning_t, std::size_t Inline>
+    struct outcome_inline
+    {
+        static_assert(Inline <= 255, "The inline count is stored in one byte");
+
+        alignas(Warning_t) unsigned char buffer[Inline * sizeof(Warning_t)];
+        std::uint8_t size = 0;
+
+        auto data () noexcept -> Warning_t* { return std::launder(reinterpret_cast<Warning_t*>(buffer)); }
+        auto data () const noexcept -> Warning_t const* { return std::launder(reinterpret_cast<Warning_t const*>(buffer)); }
+    };
+
+    /// Without the inline buffer, the sequence is a single pointer
+    template <typename Warning_t>
+    struct outcome_inline<Warning_t, 0>
+    {
+        static constexpr std::uint8_t size = 0;
+
+        auto data () noexcept -> Warning_t* { return nullptr; }
+        auto data () const noexcept -> Warning_t const* { return nullptr; }
+    };
+
+}   // end namespace result_detail
+
+/**
+ * \class outcome_warnings
+ *
+ * \brief Sequence of warnings stored inline up to the specified number
+ *
+ * \details Moves to the heap on the first warning that doesn't fit. The heap block holds its size,
+ * its capacity and the warnings, so the spilled state is one pointer that is null until then; the
+ * inline warnings are counted in one byte. An empty sequence owns no memory
+*/
+template <typename Warning_t, std::size_t Inline>
+class outcome_warnings : private result_detail::outcome_inline<Warning_t, Inline>
+{
+public:
+
+    // ANCHOR Member types
+    using value_type     = Warning_t;
+    using iterator       = value_type*;
+    using const_iterator = value_type const*;
+
+private:
+
+    using inline_type = result_detail::outcome_inline<Warning_t, Inline>;
+
+    // Header of the heap block; the warnings follow it
+    struct spill
+    {
+        std::size_t size;
+        std::size_t capacity;
+    };
+
+    // Number of warning slots the header takes at the start of the block
+    static constexpr std::size_t header_slots = (sizeof(spill) + sizeof(value_type) - 1) / sizeof(value_type);
+
+    spill* _spill = nullptr;
+
+public:
+
+    /**
+     * \brief Constructs an empty sequence
+    */
+    outcome_warnings () noexcept {}
+
+    outcome_warnings (outcome_warnings const& other)
+    {
+        auto const size = other.size();
+
+        if (size <= Inline) {
+            std::uninitialized_copy_n(other.data(), size, inline_type::data());
+            _set_inline_size(size);
+            return;
+        }
+        _spill = _allocate(size);
+
+        try {
+            std::uninitialized_copy_n(other.data(), size, _elements(_spill));
+        }
+        catch (...) {
+            _deallocate(_spill);
+            throw;
+        }
+        _spill->size = size;
+    }
+
+    outcome_warnings (outcome_warnings&& other) noexcept(std::is_nothrow_move_constructible_v<value_type>)
+    {
+        _take(std::move(other));
+    }
+
+    auto operator = (outcome_warnings const& other) -> outcome_warnings&
+    {
+        if (this != &other) {
+            *this = outcome_warnings{ other };
+        }
+        return *this;
+    }
+
+    auto operator = (outcome_warnings&& other) noexcept(std::is_nothrow_move_constructible_v<value_type>) -> outcome_warnings&
+    {
+        if (this != &other) {
+            _release();
+            _take(std::move(other));
+        }
+        return *this;
+    }
+
+    ~outcome_warnings ()
+    {
+        _release();
+    }
+
+    /**
+     * \brief Appends a warning
+     *
+     * \param args Arguments to construct the warning from
+     *
+     * \return Appended warning
+    */
+    template <typename... Args>
+    auto emplace_back (Args&&... args) -> value_type&
+    {
+        if (_spill) {
+            if (_spill->size == _spill->capacity) {
+                return _emplace_grow(std::forward<Args>(args)...);
+            }
+            auto* const slot = ::new (static_cast<void*>(_elements(_spill) + _spill->size)) value_type(std::forward<Args>(args)...);
+
+            ++_spill->size;
+            return *slot;
+        }
+        if constexpr (Inline != 0) {
+            if (inline_type::size < Inline) {
+                auto* const slot = ::new (static_cast<void*>(inline_type::data() + inline_type::size)) value_type(std::forward<Args>(args)...);
+
+                ++inline_type::size;
+                return *slot;
+            }
+        }
+        return _emplace_grow(std::forward<Args>(args)...);
+    }
+
+    /**
+     * \brief Removes all the warnings; the heap memory is kept
+    */
+    auto clear () noexcept -> void
+    {
+        std::destroy_n(data(), size());
+
+        if (_spill) _spill->size = 0;
+        else _set_inline_size(0);
+    }
+
+    [[nodiscard]] auto data () noexcept -> value_type*
+    {
+        return _spill ? _elements(_spill) : inline_type::data();
+    }
+
+    [[nodiscard]] auto data () const noexcept -> value_type const*
+    {
+        return _spill ? _elements(_spill) : inline_type::data();
+    }
+
+    [[nodiscard]] auto size () const noexcept -> std::size_t { return _spill ? _spill->size : inline_type::size; }
+    [[nodiscard]] auto empty () const noexcept -> bool { return size() == 0; }
+
+    [[nodiscard]] auto begin () noexcept -> iterator { return data(); }
+    [[nodiscard]] auto end () noexcept -> iterator { return data() + size(); }
+    [[nodiscard]] auto begin () const noexcept -> const_iterator { return data(); }
+    [[nodiscard]] auto end () const noexcept -> const_iterator { return data() + size(); }
+
+    [[nodiscard]] auto operator [] (std::size_t i) noexcept -> value_type& { return data()[i]; }
+    [[nodiscard]] auto operator [] (std::size_t i) const noexcept -> value_type const& { return data()[i]; }
+
+private:
+
+    // Allocates an empty heap block for the specified number of warnings
+    static auto _allocate (std::size_t capacity) -> spill*
+    {
+        auto* const block = std::allocator<value_type>{}.allocate(header_slots + capacity);
+
+        return ::new (static_cast<void*>(block)) spill{ 0, capacity };
+    }
+
+    static auto _deallocate (spill* block) noexcept -> void
+    {
+        auto const capacity = block->capacity;
+
+        block->~spill();
+        std::allocator<value_type>{}.deallocate(reinterpret_cast<value_type*>(block), header_slots + capacity);
+    }
+
+    static auto _elements (spill* block) noexcept -> value_type*
+    {
+        return std::launder(reinterpret_cast<value_type*>(block) + header_slots);
+    }
+
+    static auto _elements (spill const* block) noexcept -> value_type const*
+    {
+        return _elements(const_cast<spill*>(block));
+    }
+
+    auto _set_inline_size (std::size_t size) noexcept -> void
+    {
+        if constexpr (Inline != 0) {
+            inline_type::size = static_cast<std::uint8_t>(size);
+        }
+    }
+
+    // Takes the warnings of another sequence into an empty one
+    auto _take (outcome_warnings&& other) noexcept(std::is_nothrow_move_constructible_v<value_type>) -> void
+    {
+        if (other._spill) {
+            _spill = std::exchange(other._spill, nullptr);
+            return;
+        }
+        std::uninitialized_move_n(other.data(), other.size(), inline_type::data());
+        _set_inline_size(other.size());
+        other.clear();
+    }
+
+    // Destroys the warnings and frees the heap memory
+    auto _release () noexcept -> void
+    {
+        clear();
+
+        if (_spill) {
+            _deallocate(std::exchange(_spill, nullptr));
+        }
+    }
+
+    // Appends a warning to the full sequence. The new one is constructed first, as the arguments may refer to the old ones
+    template <typename... Args>
+    auto _emplace_grow (Args&&... args) -> value_type&
+    {
+        auto const size = this->size();
+        auto const capacity = size ? size * 2 : 4;
+        auto* const block = _allocate(capacity);
+        auto* slot = static_cast<value_type*>(nullptr);
+
+        try {
+            slot = ::new (static_cast<void*>(_elements(block) + size)) value_type(std::forward<Args>(args)...);
+            std::uninitialized_move_n(data(), size, _elements(block));
+        }
+        catch (...) {
+            if (slot) slot->~value_type();
+            _deallocate(block);
+            throw;
+        }
+
+        _release();
+        _spill = block;
+        _spill->size = size + 1;
+
+        return *slot;
+    }
+
+};  // end class outcome_warnings
+
+/**
+ * \brief State of an outcome
+*/
+enum class outcome_state : std::uint8_t
+{
+    ok,         ///< Success without warnings
+    warned,     ///< Success with warnings
+    error       ///< Failure; may carry the warnings collected before it
+};
+
+/**
+ * \class outcome
+ *
+ * \brief Result with the warnings of the operation
+ *
+ * \details Stores a result and a sequence of warnings that keeps a few of them inline. Without
+ * warnings, constructing, moving and reading an outcome cost as much as for the result, plus
+ * resetting and checking a pointer and a one-byte counter; nothing is allocated. The object takes
+ * the result, `Inline` warnings, the count and a pointer, with the alignment padding: 88 bytes for
+ * `outcome<int, std::string, int>`. With `Inline = 0` it's the result and a single pointer
+*/
+template <typename Ok_t, typename Warning_t, typename Error_t, std::size_t Inline = 2>
+class outcome
+{
+public:
+
+    // ANCHOR Member types
+    using result_type   = result<Ok_t, Error_t>;
+    using warnings_type = outcome_warnings<Warning_t, Inline>;
+    using ok_type       = Ok_t;
+    using warning_type  = Warning_t;
+    using error_type    = Error_t;
+
+private:
+
+    result_type _result;
+    warnings_type _warnings;
+
+public:
+
+    /**
+     * \brief Constructs an outcome without warnings from a result or anything a result is constructed from
+     *
+     * \param res Result, e.g. `result<>::ok(val)` or `Error(err)`
+    */
+    template <typename T,
+              typename = std::enable_if_t<!std::is_same_v<std::decay_t<T>, outcome> && std::is_constructible_v<result_type, T&&>>
+    >
+    outcome (T&& res) : _result(std::forward<T>(res)) {}
+
+    /**
+     * \brief Constructs an outcome from a result and its warnings; reverses `split`
+     *
+     * \param res Result of the operation
+     * \param warnings Warnings of the operation
+    */
+    outcome (result_type res, warnings_type warnings)
+        : _result{ std::move(res) }
+        , _warnings{ std::move(warnings) }
+    {}
+
+    /**
+     * \brief Adds a warning
+     *
+     * \param args Arguments to construct the warning from
+    */
+    template <typename... Args>
+    auto warn (Args&&... args) -> outcome&
+    {
+        _warnings.emplace_back(std::forward<Args>(args)...);
+        return *this;
+    }
+
+    /**
+     * \brief Returns the state of the outcome
+    */
+    [[nodiscard]]
+    auto state () const noexcept -> outcome_state
+    {
+        if (_result.is_error()) return outcome_state::error;
+
+        return _warnings.empty() ? outcome_state::ok : outcome_state::warned;
+    }
+
+    /**
+     * \brief Returns `true` if the operation succeeded, with or without warnings
+    */
+    [[nodiscard]]
+    auto is_ok () const noexcept -> bool
+    {
+        return _result.is_ok();
+    }
+
+    /**
+     * \brief Returns `true` if the operation failed
+    */
+    [[nodiscard]]
+    auto is_error () const noexcept -> bool
+    {
+        return _result.is_error();
+    }
+
+    /**
+     * \brief Returns `true` if there are warnings
+    */
+    [[nodiscard]]
+    auto has_warnings () const noexcept -> bool
+    {
+        return !_warnings.empty();
+    }
+
+    /**
+     * \brief Returns the warnings
+    */
+    [[nodiscard]]
+    auto warnings () const noexcept -> warnings_type const&
+    {
+        return _warnings;
+    }
+
+    /**
+     * \brief Returns the result without copying it
+    */
+    [[nodiscard]]
+    auto as_result () const& noexcept -> result_type const&
+    {
+        return _result;
+    }
+
+    /**
+     * \brief Extracts the result, dropping the warnings
+    */
+    [[nodiscard]]
+    auto into_result () && -> result_type
+    {
+        return std::move(_result);
+    }
+
+    /**
+     * \brief Splits the outcome into the result and the warnings without a loss
+    */
+    [[nodiscard]]
+    auto split () && -> std::pair<result_type, warnings_type>
+    {
+        return { std::move(_result), std::move(_warnings) };
+    }
+
+    /**
+     * \brief Returns the success value
+     *
+     * \throw bad_result_access
+    */
+    [[nodiscard]]
+    auto unwrap () const& -> ok_type const&
+    {
+        if (_result.is_error()) result_detail::throw_bad_access();
+        return _result.unwrap_unchecked();
+    }
+
+    /**
+     * \brief Returns the error value
+     *
+     * \throw bad_result_access
+    */
+    [[nodiscard]]
+    auto unwrap_error () const& -> error_type const&
+    {
+        if (_result.is_ok()) result_detail::throw_bad_access();
+        return _result.unwrap_error_unchecked();
+    }
+
+};  // end class outcome
+
+#endif  // RESULT_OUTCOME_H
+
+// MIT License
+//
+// Copyright (c) 2021 Alex Qzminsky
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
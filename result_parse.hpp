@@ -0,0 +1,332 @@
+#pragma once
+
+// Copyright © 2021 Alex Qzminsky.
+// License: MIT. All rights reserved.
+
+/// \brief Result variant type: parser combinators extension
+///
+/// \details A parser is a functor taking `std::string_view` and returning `parse_result<T>`:
+/// the parsed value with the rest of the input, or the failure point. Parsers don't allocate,
+/// text values are views into the input
+///
+/// \author https://github.com/qzminsky
+/// \version 0.1.0
+/// \date 2026/10/16
+
+#ifndef RESULT_PARSE_H
+#define RESULT_PARSE_H
+
+static_assert(__cplusplus >= 2017'00, "C++17 or higher is required");
+
+#include "result.hpp"
+
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+/**
+ * \brief Parsing failure
+*/
+struct parse_error
+{
+    /// Input remaining at the failure point; its offset is `where.data() - input.data()`
+    std::string_view where;
+
+    /// Description of the expected input
+    char const* expected;
+};
+
+/// Parsed value and the rest of the input, or the failure
+template <typename T>
+using parse_result = result<std::pair<T, std::string_view>, parse_error>;
+
+namespace result_parse
+{
+    namespace detail
+    {
+        /// Value type of a parser
+        template <typename Parser>
+        using value_t = typename std::invoke_result_t<Parser const&, std::string_view>::ok_type::first_type;
+
+        /// Returns a parsed value with the rest of the input
+        template <typename T, typename Value>
+        constexpr auto parsed (Value&& val, std::string_view rest) -> parse_result<T>
+        {
+            return parse_result<T>{ std::in_place_index<0>, std::forward<Value>(val), rest };
+        }
+
+        /// Returns a failure
+        template <typename T>
+        constexpr auto failed (parse_error const& err) -> parse_result<T>
+        {
+            return parse_result<T>{ std::in_place_index<1>, err };
+        }
+
+        /// Applies the parsers from the I-th one on; the values parsed so far are passed by reference
+        /// and moved into the tuple once, at the end
+        template <std::size_t I, typename T, typename Parsers, typename... Values>
+        constexpr auto seq_from (Parsers const& parsers, std::string_view input, Values&&... values) -> parse_result<T>
+        {
+            if constexpr (I == std::tuple_size_v<Parsers>) {
+                return parsed<T>(T{ std::forward<Values>(values)... }, input);
+            }
+            else {
+                auto res = std::get<I>(parsers)(input);
+
+                if (res.is_error()) {
+                    return failed<T>(res.unwrap_error_unchecked());
+                }
+                auto& [value, remaining] = res.unwrap_unchecked();
+
+                return seq_from<I + 1, T>(parsers, remaining, std::forward<Values>(values)..., std::move(value));
+            }
+        }
+
+        /// Applies the alternatives from the I-th one on until one succeeds
+        template <std::size_t I, typename T, typename Parsers>
+        constexpr auto alt_from (Parsers const& parsers, std::string_view input) -> parse_result<T>
+        {
+            auto head = std::get<I>(parsers)(input);
+
+            if (head.is_ok()) {
+                auto& [value, remaining] = head.unwrap_unchecked();
+                return parsed<T>(std::move(value), remaining);
+            }
+            if constexpr (I + 1 == std::tuple_size_v<Parsers>) {
+                return failed<T>(head.unwrap_error_unchecked());
+            }
+            else {
+                auto other = alt_from<I + 1, T>(parsers, input);
+
+                if (other.is_ok()) return other;
+
+                auto const& near = head.unwrap_error_unchecked();
+                auto const& far = other.unwrap_error_unchecked();
+
+                return failed<T>(far.where.size() < near.where.size() ? far : near);
+            }
+        }
+
+    }   // end namespace detail
+
+    /**
+     * \brief Parses the exact text
+     *
+     * \param text Expected text; the parser keeps a view of it
+     *
+     * \return Parser of the matched input
+    */
+    constexpr auto literal (std::string_view text)
+    {
+        return [text](std::string_view input) constexpr -> parse_result<std::string_view> {
+            if (input.substr(0, text.size()) == text) {
+                return detail::parsed<std::string_view>(input.substr(0, text.size()), input.substr(text.size()));
+            }
+            return detail::failed<std::string_view>({ input, "literal" });
+        };
+    }
+
+    /**
+     * \brief Parses the longest (possibly empty) prefix of characters satisfying the predicate
+     *
+     * \param pred Predicate taking `char`
+     *
+     * \return Parser of the matched input
+    */
+    template <typename Predicate>
+    constexpr auto take_while (Predicate pred)
+    {
+        return [pred](std::string_view input) constexpr -> parse_result<std::string_view> {
+            auto length = std::size_t{ 0 };
+
+            while (length < input.size() && pred(input[length])) {
+                ++length;
+            }
+            return detail::parsed<std::string_view>(input.substr(0, length), input.substr(length));
+        };
+    }
+
+    /**
+     * \brief Parses the input up to the delimiter, which is not consumed
+     *
+     * \details The delimiter is searched by `std::string_view::find`, i.e. `memchr` in most libraries
+     *
+     * \param delim Delimiter
+     *
+     * \return Parser of the input before the delimiter
+    */
+    constexpr auto take_until (char delim)
+    {
+        return [delim](std::string_view input) constexpr -> parse_result<std::string_view> {
+            if (auto const pos = input.find(delim); pos != std::string_view::npos) {
+                return detail::parsed<std::string_view>(input.substr(0, pos), input.substr(pos));
+            }
+            return detail::failed<std::string_view>({ input.substr(input.size()), "delimiter" });
+        };
+    }
+
+    /**
+     * \brief Applies the parsers one after another
+     *
+     * \param first First parser
+     * \param rest Other parsers
+     *
+     * \return Parser of the tuple of the values
+    */
+    template <typename Parser, typename... Parsers>
+    constexpr auto seq (Parser first, Parsers... rest)
+    {
+        using value_type = std::tuple<detail::value_t<Parser>, detail::value_t<Parsers>...>;
+
+        return [parsers = std::tuple<Parser, Parsers...>{ std::move(first), std::move(rest)... }]
+               (std::string_view input) constexpr -> parse_result<value_type> {
+            return detail::seq_from<0, value_type>(parsers, input);
+        };
+    }
+
+    /**
+     * \brief Applies the parsers in order until one succeeds
+     *
+     * \details If all of them fail, the failure that got furthest into the input is returned
+     *
+     * \param first First alternative
+     * \param rest Other alternatives
+     *
+     * \return Parser of the common type of the values
+    */
+    template <typename Parser, typename... Parsers>
+    constexpr auto alt (Parser first, Parsers... rest)
+    {
+        using value_type = std::common_type_t<detail::value_t<Parser>, detail::value_t<Parsers>...>;
+
+        return [parsers = std::tuple<Parser, Parsers...>{ std::move(first), std::move(rest)... }]
+               (std::string_view input) constexpr -> parse_result<value_type> {
+            return detail::alt_from<0, value_type>(parsers, input);
+        };
+    }
+
+    /**
+     * \brief Applies the parser while it succeeds and consumes input
+     *
+     * \param parser Parser to repeat
+     *
+     * \return Parser of the consumed input; never fails
+    */
+    template <typename Parser>
+    constexpr auto many (Parser parser)
+    {
+        return [parser](std::string_view input) constexpr -> parse_result<std::string_view> {
+            auto rest = input;
+
+            for (;;) {
+                auto res = parser(rest);
+
+                if (res.is_error() || res.unwrap_unchecked().second.size() == rest.size()) break;
+
+                rest = res.unwrap_unchecked().second;
+            }
+            return detail::parsed<std::string_view>(input.substr(0, input.size() - rest.size()), rest);
+        };
+    }
+
+    /**
+     * \brief Transforms the value of the parser
+     *
+     * \param parser Parser to apply
+     * \param func Functor taking the parsed value
+     *
+     * \return Parser of the returned values
+    */
+    template <typename Parser, typename Functor>
+    constexpr auto map (Parser parser, Functor func)
+    {
+        using value_type = std::decay_t<std::invoke_result_t<Functor const&, detail::value_t<Parser>&&>>;
+
+        return [parser, func](std::string_view input) constexpr -> parse_result<value_type> {
+            auto res = parser(input);
+
+            if (res.is_error()) {
+                return detail::failed<value_type>(res.unwrap_error_unchecked());
+            }
+            auto& [value, remaining] = res.unwrap_unchecked();
+
+            return detail::parsed<value_type>(func(std::move(value)), remaining);
+        };
+    }
+
+    /**
+     * \brief Names the input expected by the parser in its failure
+     *
+     * \param parser Parser to apply
+     * \param what Description of the expected input
+     *
+     * \return Parser failing at its start point with the description
+    */
+    template <typename Parser>
+    constexpr auto expect (Parser parser, char const* what)
+    {
+        using value_type = detail::value_t<Parser>;
+
+        return [parser, what](std::string_view input) constexpr -> parse_result<value_type> {
+            auto res = parser(input);
+
+            if (res.is_error()) {
+                return detail::failed<value_type>({ input, what });
+            }
+            auto& [value, remaining] = res.unwrap_unchecked();
+
+            return detail::parsed<value_type>(std::move(value), remaining);
+        };
+    }
+
+    /**
+     * \brief Applies the parser to the whole input
+     *
+     * \param parser Parser to apply
+     * \param input Input to parse
+     *
+     * \return Parsed value or the failure; unparsed input is an `"end of input"` failure
+    */
+    template <typename Parser>
+    constexpr auto parse (Parser const& parser, std::string_view input) -> result<detail::value_t<Parser>, parse_error>
+    {
+        using parsed_type = result<detail::value_t<Parser>, parse_error>;
+
+        auto res = parser(input);
+
+        if (res.is_error()) {
+            return parsed_type{ std::in_place_index<1>, res.unwrap_error_unchecked() };
+        }
+        auto& [value, rest] = res.unwrap_unchecked();
+
+        if (!rest.empty()) {
+            return parsed_type{ std::in_place_index<1>, parse_error{ rest, "end of input" } };
+        }
+        return parsed_type{ std::in_place_index<0>, std::move(value) };
+    }
+
+}   // end namespace result_parse
+
+#endif  // RESULT_PARSE_H
+
+// MIT License
+//
+// Copyright (c) 2021 Alex Qzminsky
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
@@ -0,0 +1,90 @@
+#pragma once
+
+// Copyright © 2021 Alex Qzminsky.
+// License: MIT. All rights reserved.
+
+/// \brief Result variant type: polymorphic allocator aliases
+///
+/// \author https://github.com/qzminsky
+/// \version 0.1.0
+/// \date 2026/10/16
+
+#ifndef RESULT_PMR_H
+#define RESULT_PMR_H
+
+static_assert(__cplusplus >= 2017'00, "C++17 or higher is required");
+
+#include "result.hpp"
+
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+namespace result_pmr
+{
+    /// Polymorphic allocator passed to the results
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+    /// Result with a text error allocated from a memory resource
+    template <typename Ok_t>
+    using string_result = result<Ok_t, std::pmr::string>;
+
+    /// Sequence of results; the elements get the memory resource of the sequence
+    template <typename Ok_t, typename Error_t>
+    using vector = std::pmr::vector<result<Ok_t, Error_t>>;
+
+    /**
+     * \brief Constructs the value of the specified state in place with the memory resource
+     *
+     * \param resource Memory resource to allocate the value from
+     * \param tag State index: `0` for success, `1` for failure
+     * \param args Arguments to construct the value from
+    */
+    template <typename Result, std::size_t I, typename... Args>
+    auto make (std::pmr::memory_resource* resource, std::in_place_index_t<I> tag, Args&&... args) -> Result
+    {
+        static_assert(result_detail::is_result_v<Result>, "The constructed type must be a result");
+
+        return Result{ std::allocator_arg, allocator_type{ resource }, tag, std::forward<Args>(args)... };
+    }
+
+    /**
+     * \brief Copies or moves a result into the memory resource
+     *
+     * \param resource Memory resource to allocate the value from
+     * \param res Result to copy or move
+    */
+    template <typename Result>
+    auto copy (std::pmr::memory_resource* resource, Result&& res) -> std::decay_t<Result>
+    {
+        static_assert(result_detail::is_result_v<Result>, "The copied type must be a result");
+
+        return std::decay_t<Result>{ std::allocator_arg, allocator_type{ resource }, std::forward<Result>(res) };
+    }
+
+}   // end namespace result_pmr
+
+#endif  // RESULT_PMR_H
+
+// MIT License
+//
+// Copyright (c) 2021 Alex Qzminsky
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
@@ -0,0 +1,377 @@
+#pragma once
+
+// Copyright © 2021 Alex Qzminsky.
+// License: MIT. All rights reserved.
+
+/// \brief Result variant type: retry with backoff extension
+///
+/// \author https://github.com/qzminsky
+/// \version 0.1.0
+/// \date 2026/10/16
+
+#ifndef RESULT_RETRY_H
+#define RESULT_RETRY_H
+
+static_assert(__cplusplus >= 2017'00, "C++17 or higher is required");
+
+#include "result.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <thread>
+
+#if __cplusplus >= 2020'00 && __has_include(<coroutine>)
+#   include <coroutine>
+#   include <exception>
+#   define RESULT_RETRY_COROUTINES
+#endif
+
+/**
+ * \class retry_budget
+ *
+ * \brief Number of retries shared between threads
+ *
+ * \details Each retry takes one token; when the budget is exhausted, the failure is returned
+ * immediately. This keeps a fleet of retrying callers from multiplying the load on a
+ * degraded dependency
+*/
+class retry_budget
+{
+    std::atomic<std::size_t> _tokens;
+
+public:
+
+    /**
+     * \brief Constructs a budget with the specified number of retries
+     *
+     * \param tokens Initial number of retries
+    */
+    explicit retry_budget (std::size_t tokens) noexcept : _tokens{ tokens } {}
+
+    retry_budget (retry_budget const&) = delete;
+    auto operator = (retry_budget const&) -> retry_budget& = delete;
+
+    /**
+     * \brief Takes a retry token. Returns `false` if the budget is exhausted
+    */
+    [[nodiscard]]
+    auto try_acquire () noexcept -> bool
+    {
+        auto tokens = _tokens.load(std::memory_order_relaxed);
+
+        while (tokens != 0) {
+            if (_tokens.compare_exchange_weak(tokens, tokens - 1, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * \brief Returns retry tokens to the budget
+     *
+     * \param tokens Number of retries to add
+    */
+    auto deposit (std::size_t tokens = 1) noexcept -> void
+    {
+        _tokens.fetch_add(tokens, std::memory_order_relaxed);
+    }
+
+    /**
+     * \brief Returns the number of retries left
+    */
+    [[nodiscard]]
+    auto remaining () const noexcept -> std::size_t
+    {
+        return _tokens.load(std::memory_order_relaxed);
+    }
+
+};  // end class retry_budget
+
+/**
+ * \brief Retry policy: attempts limit, exponential backoff with jitter and a deadline
+*/
+struct retry_policy
+{
+    using clock_type = std::chrono::steady_clock;
+
+    /// Maximal number of invocations including the first one
+    std::size_t max_attempts = 3;
+
+    /// Delay before the first retry
+    clock_type::duration initial_delay = std::chrono::milliseconds{ 10 };
+
+    /// Upper bound of the delay growth
+    clock_type::duration max_delay = std::chrono::seconds{ 1 };
+
+    /// Delay growth factor
+    double multiplier = 2.0;
+
+    /// Fraction of each delay that is randomized: `0` is no jitter, `1` is full jitter
+    double jitter = 0.5;
+
+    /// No retry is started if it cannot begin before this time point
+    clock_type::time_point deadline = clock_type::time_point::max();
+
+    /// Optional budget of retries shared with other callers
+    retry_budget* budget = nullptr;
+};
+
+namespace result_detail
+{
+    /// Returns a pseudo-random number in [0, 1) from a per-thread xorshift generator
+    inline auto jitter_sample () noexcept -> double
+    {
+        thread_local std::uint64_t state = static_cast<std::uint64_t>(
+            std::chrono::steady_clock::now().time_since_epoch().count()
+        ) ^ reinterpret_cast<std::uintptr_t>(&state) ^ 0x9e3779b97f4a7c15ull;
+
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        return static_cast<double>(state >> 11) * 0x1.0p-53;
+    }
+
+    /// Retry decisions shared by the blocking and the coroutine loops
+    class retry_state
+    {
+        retry_policy const& _policy;
+        std::size_t _attempt = 1;
+        retry_policy::clock_type::duration _delay;
+
+    public:
+
+        explicit retry_state (retry_policy const& policy) noexcept
+            : _policy{ policy }
+            , _delay{ policy.initial_delay }
+        {}
+
+        /// Returns the pause before the next attempt, or nothing if the result is final
+        template <typename Result, typename Classifier>
+        auto next (Result const& res, Classifier& is_transient) -> std::optional<retry_policy::clock_type::duration>
+        {
+            if (res.is_ok() || _attempt >= _policy.max_attempts || !std::invoke(is_transient, access::get<1>(res))) {
+                return std::nullopt;
+            }
+
+            auto const randomized = std::chrono::duration_cast<retry_policy::clock_type::duration>(
+                _delay * (_policy.jitter * jitter_sample())
+            );
+            auto const pause = _delay - randomized;
+
+            if (retry_policy::clock_type::now() + pause >= _policy.deadline) {
+                return std::nullopt;
+            }
+            if (_policy.budget && !_policy.budget->try_acquire()) {
+                return std::nullopt;
+            }
+
+            ++_attempt;
+            _delay = std::min(
+                std::chrono::duration_cast<retry_policy::clock_type::duration>(_delay * _policy.multiplier),
+                _policy.max_delay
+            );
+            return pause;
+        }
+    };
+
+    /// Classifies every error as transient
+    struct always_transient
+    {
+        template <typename T>
+        auto operator () (T const&) const noexcept -> bool { return true; }
+    };
+
+}   // end namespace result_detail
+
+/**
+ * \brief Invokes a result-returning functor until it succeeds or the failure is final
+ *
+ * \details The failure is final if it's classified as permanent, the attempts or the shared
+ * budget are exhausted, or the next retry would start after the deadline. The thread sleeps
+ * between the attempts
+ *
+ * \param policy Retry policy
+ * \param func Result-returning functor to invoke
+ * \param is_transient Predicate over the error value; returns `true` if the error is worth a retry
+ *
+ * \return The last result produced by the functor
+*/
+template <typename Functor, typename Classifier>
+auto retry (retry_policy const& policy, Functor&& func, Classifier&& is_transient) -> std::invoke_result_t<Functor&>
+{
+    static_assert(result_detail::is_result_v<std::invoke_result_t<Functor&>>, "The retried functor must return a result");
+
+    auto state = result_detail::retry_state{ policy };
+
+    for (;;) {
+        auto res = std::invoke(func);
+
+        if (auto pause = state.next(res, is_transient)) {
+            std::this_thread::sleep_for(*pause);
+        }
+        else return res;
+    }
+}
+
+/**
+ * \brief Invokes a result-returning functor until it succeeds, treating every error as transient
+ *
+ * \param policy Retry policy
+ * \param func Result-returning functor to invoke
+ *
+ * \return The last result produced by the functor
+*/
+template <typename Functor>
+auto retry (retry_policy const& policy, Functor&& func) -> std::invoke_result_t<Functor&>
+{
+    return retry(policy, std::forward<Functor>(func), result_detail::always_transient{});
+}
+
+#ifdef RESULT_RETRY_COROUTINES
+
+/**
+ * \class retry_task
+ *
+ * \brief Lazily started coroutine producing the result of `co_retry`
+ *
+ * \details Starts when awaited and resumes the awaiting coroutine on completion
+*/
+template <typename Result>
+class [[nodiscard]] retry_task
+{
+public:
+
+    struct promise_type
+    {
+        std::optional<Result> value;
+        std::exception_ptr error;
+        std::coroutine_handle<> continuation;
+
+        promise_type () noexcept = default;
+
+        struct final_awaiter
+        {
+            auto await_ready () const noexcept -> bool { return false; }
+
+            auto await_suspend (std::coroutine_handle<promise_type> self) noexcept -> std::coroutine_handle<>
+            {
+                if (auto next = self.promise().continuation) {
+                    return next;
+                }
+                return std::noop_coroutine();
+            }
+
+            auto await_resume () const noexcept -> void {}
+        };
+
+        auto get_return_object () noexcept -> retry_task
+        {
+            return retry_task{ std::coroutine_handle<promise_type>::from_promise(*this) };
+        }
+
+        auto initial_suspend () const noexcept -> std::suspend_always { return {}; }
+        auto final_suspend () const noexcept -> final_awaiter { return {}; }
+
+        template <typename T>
+        auto return_value (T&& val) -> void { value.emplace(std::forward<T>(val)); }
+
+        auto unhandled_exception () noexcept -> void { error = std::current_exception(); }
+    };
+
+private:
+
+    std::coroutine_handle<promise_type> _handle;
+
+    explicit retry_task (std::coroutine_handle<promise_type> handle) noexcept : _handle{ handle } {}
+
+public:
+
+    retry_task (retry_task&& other) noexcept : _handle{ std::exchange(other._handle, {}) } {}
+
+    retry_task (retry_task const&) = delete;
+    auto operator = (retry_task const&) -> retry_task& = delete;
+    auto operator = (retry_task&&) -> retry_task& = delete;
+
+    ~retry_task ()
+    {
+        if (_handle) _handle.destroy();
+    }
+
+    auto await_ready () const noexcept -> bool { return false; }
+
+    auto await_suspend (std::coroutine_handle<> awaiting) noexcept -> std::coroutine_handle<>
+    {
+        _handle.promise().continuation = awaiting;
+        return _handle;
+    }
+
+    auto await_resume () -> Result
+    {
+        if (_handle.promise().error) {
+            std::rethrow_exception(_handle.promise().error);
+        }
+        return std::move(*_handle.promise().value);
+    }
+
+};  // end class retry_task
+
+/**
+ * \brief Coroutine version of `retry` that suspends between the attempts instead of blocking
+ *
+ * \param policy Retry policy
+ * \param func Result-returning functor to invoke
+ * \param is_transient Predicate over the error value; returns `true` if the error is worth a retry
+ * \param sleep Functor taking a duration and returning an awaitable that resumes after it,
+ * e.g. a timer of the executor in use
+ *
+ * \return Awaitable task producing the last result of the functor
+*/
+template <typename Functor, typename Classifier, typename Sleep>
+auto co_retry (retry_policy policy, Functor func, Classifier is_transient, Sleep sleep)
+    -> retry_task<std::invoke_result_t<Functor&>>
+{
+    static_assert(result_detail::is_result_v<std::invoke_result_t<Functor&>>, "The retried functor must return a result");
+
+    auto state = result_detail::retry_state{ policy };
+
+    for (;;) {
+        auto res = std::invoke(func);
+
+        if (auto pause = state.next(res, is_transient)) {
+            co_await sleep(*pause);
+        }
+        else co_return std::move(res);
+    }
+}
+
+#endif  // RESULT_RETRY_COROUTINES
+
+#endif  // RESULT_RETRY_H
+
+// MIT License
+//
+// Copyright (c) 2021 Alex Qzminsky
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
@@ -0,0 +1,351 @@
+#pragma once
+
+// Copyright © 2021 Alex Qzminsky.
+// License: MIT. All rights reserved.
+
+/// \brief Result variant type: binary serialization extension
+///
+/// \details Encoding of a result is a state byte (`0` for success, `1` for failure) followed by
+/// the encoding of the stored value. Arithmetic and enumeration values are copied as is, so the
+/// encoding is only portable between processes of the same architecture
+///
+/// \author https://github.com/qzminsky
+/// \version 0.1.0
+/// \date 2026/10/16
+
+#ifndef RESULT_SERIALIZE_H
+#define RESULT_SERIALIZE_H
+
+static_assert(__cplusplus >= 2017'00, "C++17 or higher is required");
+
+#include "result.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * \brief Customization point: encoding of a value stored in a result
+ *
+ * \details A specialization provides:
+ *
+ *     static auto size (T const& val) -> std::size_t;                         // bytes written by `write`
+ *     static auto write (T const& val, std::byte* out) -> void;
+ *     static auto extent (std::byte const* in, std::size_t avail) -> std::size_t;  // encoded size, 0 if truncated
+ *     static auto read (std::byte const* in) -> T;                               // `in` holds `extent` bytes
+ *
+ * The buffers may be unaligned. Types opted in by `is_trivially_serializable` and `std::string`
+ * are supported out of the box
+*/
+template <typename T, typename = void>
+struct result_serializer;
+
+/**
+ * \brief Customization point: enables the byte-wise encoding of a trivially copyable type
+ *
+ * \details Holds for arithmetic, enumeration and empty types. Other class types are opted in by
+ * a specialization deriving from `std::true_type`. Pointers aren't supported: the address means
+ * nothing to the reader, and the same holds for classes holding one, such as `std::string_view`
+*/
+template <typename T>
+struct is_trivially_serializable
+    : std::bool_constant<std::is_arithmetic_v<T> || std::is_enum_v<T> || (std::is_class_v<T> && std::is_empty_v<T>)>
+{};
+
+template <typename T>
+inline constexpr bool is_trivially_serializable_v = is_trivially_serializable<T>::value;
+
+template <typename T>
+struct result_serializer<T, std::enable_if_t<is_trivially_serializable_v<T>>>
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be encoded byte-wise");
+    static_assert(!std::is_pointer_v<T> && !std::is_member_pointer_v<T>, "Pointers can't be encoded");
+
+    static constexpr std::size_t width = std::is_empty_v<T> ? 0 : sizeof(T);
+
+    static auto size (T const&) noexcept -> std::size_t { return width; }
+
+    static auto write (T const& val, std::byte* out) noexcept -> void
+    {
+        if constexpr (width != 0) std::memcpy(out, &val, width);
+    }
+
+    static auto extent (std::byte const*, std::size_t avail) noexcept -> std::size_t
+    {
+        return avail >= width ? width : 0;
+    }
+
+    static auto read (std::byte const* in) noexcept -> T
+    {
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        if constexpr (width != 0) std::memcpy(storage, in, width);
+        return *std::launder(reinterpret_cast<T const*>(storage));
+    }
+};
+
+template <typename Char, typename Traits, typename Alloc>
+struct result_serializer<std::basic_string<Char, Traits, Alloc>>
+{
+    using string_type = std::basic_string<Char, Traits, Alloc>;
+
+    // Length prefix; wide enough for any string, so the length is never truncated
+    using length_type = std::uint64_t;
+
+    static auto size (string_type const& str) noexcept -> std::size_t
+    {
+        return sizeof(length_type) + str.size() * sizeof(Char);
+    }
+
+    static auto write (string_type const& str, std::byte* out) noexcept -> void
+    {
+        auto const length = length_type{ str.size() };
+
+        std::memcpy(out, &length, sizeof length);
+        std::memcpy(out + sizeof length, str.data(), str.size() * sizeof(Char));
+    }
+
+    static auto extent (std::byte const* in, std::size_t avail) noexcept -> std::size_t
+    {
+        auto length = length_type{ 0 };
+
+        if (avail < sizeof length) return 0;
+
+        std::memcpy(&length, in, sizeof length);
+
+        // Compared before multiplying, so a corrupt length can't wrap around
+        if (length > (avail - sizeof length) / sizeof(Char)) return 0;
+
+        return sizeof length + static_cast<std::size_t>(length) * sizeof(Char);
+    }
+
+    static auto read (std::byte const* in) -> string_type
+    {
+        auto length = length_type{ 0 };
+        std::memcpy(&length, in, sizeof length);
+
+        auto str = string_type(static_cast<std::size_t>(length), Char{});
+        std::memcpy(str.data(), in + sizeof length, str.size() * sizeof(Char));
+
+        return str;
+    }
+};
+
+/**
+ * \brief Reason of a rejected encoding
+*/
+enum class serialize_error : std::uint8_t
+{
+    truncated,  ///< The buffer ends before the encoded result
+    bad_state   ///< The state byte is neither `0` nor `1`
+};
+
+namespace result_detail
+{
+    /// Encoded size of a payload of zero width; the state byte alone tells it apart
+    template <typename T>
+    inline constexpr bool is_unsized_v = is_trivially_serializable_v<T> && std::is_empty_v<T>;
+
+}   // end namespace result_detail
+
+/**
+ * \brief Returns the number of bytes `serialize` writes for the result
+ *
+ * \param res Result to encode
+*/
+template <typename Ok_t, typename Error_t>
+[[nodiscard]]
+auto serialized_size (result<Ok_t, Error_t> const& res) -> std::size_t
+{
+    return 1 + (res.is_ok()
+        ? result_serializer<Ok_t>::size(res.unwrap_unchecked())
+        : result_serializer<Error_t>::size(res.unwrap_error_unchecked())
+    );
+}
+
+/**
+ * \brief Encodes the result into the buffer
+ *
+ * \param res Result to encode
+ * \param out Buffer of at least `serialized_size(res)` bytes
+ *
+ * \return Number of bytes written
+*/
+template <typename Ok_t, typename Error_t>
+auto serialize (result<Ok_t, Error_t> const& res, std::byte* out) -> std::size_t
+{
+    out[0] = std::byte(res.is_error());
+
+    if (res.is_ok()) {
+        result_serializer<Ok_t>::write(res.unwrap_unchecked(), out + 1);
+        return 1 + result_serializer<Ok_t>::size(res.unwrap_unchecked());
+    }
+    result_serializer<Error_t>::write(res.unwrap_error_unchecked(), out + 1);
+    return 1 + result_serializer<Error_t>::size(res.unwrap_error_unchecked());
+}
+
+/**
+ * \brief Appends the encoding of the result to the byte vector
+ *
+ * \param res Result to encode
+ * \param out Vector to append to
+*/
+template <typename Ok_t, typename Error_t>
+auto serialize (result<Ok_t, Error_t> const& res, std::vector<std::byte>& out) -> void
+{
+    auto const offset = out.size();
+
+    out.resize(offset + serialized_size(res));
+    serialize(res, out.data() + offset);
+}
+
+/**
+ * \class result_view
+ *
+ * \brief Non-owning view of an encoded result in a byte buffer
+ *
+ * \details The state is read without decoding the value; values are decoded on access.
+ * The buffer must outlive the view
+*/
+template <typename Ok_t, typename Error_t>
+class result_view
+{
+public:
+
+    // ANCHOR Member types
+    using ok_type     = Ok_t;
+    using error_type  = Error_t;
+    using result_type = result<ok_type, error_type>;
+
+private:
+
+    std::byte const* _data;
+    std::size_t _size;
+
+    result_view (std::byte const* data, std::size_t size) noexcept : _data{ data }, _size{ size } {}
+
+public:
+
+    /**
+     * \brief Checks the encoding at the beginning of the buffer and returns a view of it
+     *
+     * \param data Buffer to read
+     * \param avail Number of bytes available in the buffer
+    */
+    [[nodiscard]]
+    static auto parse (std::byte const* data, std::size_t avail) -> result<result_view, serialize_error>
+    {
+        using parsed = result<result_view, serialize_error>;
+
+        if (avail == 0) {
+            return parsed{ std::in_place_index<1>, serialize_error::truncated };
+        }
+        if (data[0] != std::byte{ 0 } && data[0] != std::byte{ 1 }) {
+            return parsed{ std::in_place_index<1>, serialize_error::bad_state };
+        }
+
+        auto const is_ok = data[0] == std::byte{ 0 };
+        auto const payload = is_ok
+            ? result_serializer<ok_type>::extent(data + 1, avail - 1)
+            : result_serializer<error_type>::extent(data + 1, avail - 1);
+
+        auto const unsized = is_ok ? result_detail::is_unsized_v<ok_type> : result_detail::is_unsized_v<error_type>;
+
+        if (payload == 0 && !unsized) {
+            return parsed{ std::in_place_index<1>, serialize_error::truncated };
+        }
+        return parsed{ std::in_place_index<0>, result_view{ data, 1 + payload } };
+    }
+
+    /**
+     * \brief Predicate. Returns `true` in case of success result
+    */
+    [[nodiscard]]
+    auto is_ok () const noexcept -> bool
+    {
+        return _data[0] == std::byte{ 0 };
+    }
+
+    /**
+     * \brief Predicate. Returns `true` in case of failure result
+    */
+    [[nodiscard]]
+    auto is_error () const noexcept -> bool
+    {
+        return !is_ok();
+    }
+
+    /**
+     * \brief Returns the number of bytes of the encoding, to skip to the next one
+    */
+    [[nodiscard]]
+    auto size () const noexcept -> std::size_t
+    {
+        return _size;
+    }
+
+    /**
+     * \brief Decodes the stored value in case of success result and returns it
+     *
+     * \throw bad_result_access
+    */
+    [[nodiscard]]
+    auto unwrap () const -> ok_type
+    {
+        if (!is_ok()) result_detail::throw_bad_access();
+        return result_serializer<ok_type>::read(_data + 1);
+    }
+
+    /**
+     * \brief Decodes the stored value in case of failure result and returns it
+     *
+     * \throw bad_result_access
+    */
+    [[nodiscard]]
+    auto unwrap_error () const -> error_type
+    {
+        if (!is_error()) result_detail::throw_bad_access();
+        return result_serializer<error_type>::read(_data + 1);
+    }
+
+    /**
+     * \brief Decodes the whole result
+    */
+    [[nodiscard]]
+    auto load () const -> result_type
+    {
+        if (is_ok()) {
+            return result_type{ std::in_place_index<0>, result_serializer<ok_type>::read(_data + 1) };
+        }
+        return result_type{ std::in_place_index<1>, result_serializer<error_type>::read(_data + 1) };
+    }
+
+};  // end class result_view
+
+#endif  // RESULT_SERIALIZE_H
+
+// MIT License
+//
+// Copyright (c) 2021 Alex Qzminsky
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
@@ -0,0 +1,106 @@
+#pragma once
+
+// Copyright © 2021 Alex Qzminsky.
+// License: MIT. All rights reserved.
+
+/// \brief Result variant type: system calls extension
+///
+/// \author https://github.com/qzminsky
+/// \version 0.1.0
+/// \date 2026/10/16
+
+#ifndef RESULT_SYS_H
+#define RESULT_SYS_H
+
+static_assert(__cplusplus >= 2017'00, "C++17 or higher is required");
+
+#include "result.hpp"
+
+#include <cerrno>
+#include <functional>
+#include <system_error>
+
+/**
+ * \brief Result of a system call: the returned value or the `errno` code
+ *
+ * \details `std::errc` is a plain enumeration, so no error category is involved until the
+ * code is converted by `std::make_error_code`
+*/
+template <typename T>
+using sys_result = result<T, std::errc>;
+
+/**
+ * \brief Handling of the calls interrupted by a signal
+*/
+enum class sys_eintr : bool
+{
+    fail,   ///< Return `std::errc::interrupted` to the caller
+    retry   ///< Restart the call
+};
+
+/**
+ * \brief Converts the return value of a system call reporting errors by `-1` and `errno`
+ *
+ * \details Must be called right after the system call, before `errno` can be overwritten
+ *
+ * \param ret Returned value
+*/
+template <typename T>
+[[nodiscard]]
+inline auto sys_check (T ret) noexcept -> sys_result<T>
+{
+    static_assert(std::is_integral_v<T>, "Only the calls returning integers signal errors by -1");
+
+    if (ret != T(-1)) {
+        return sys_result<T>{ std::in_place_index<0>, ret };
+    }
+    return sys_result<T>{ std::in_place_index<1>, static_cast<std::errc>(errno) };
+}
+
+/**
+ * \brief Invokes a system call reporting errors by `-1` and `errno`
+ *
+ * \tparam Eintr Handling of the interrupted calls
+ *
+ * \param call System call or another function following its convention
+ * \param args Arguments to pass; they are passed as lvalues, so retries see the same values
+ *
+ * \return Returned value or the error code
+*/
+template <sys_eintr Eintr = sys_eintr::fail, typename Syscall, typename... Args>
+[[nodiscard]]
+inline auto sys_call (Syscall&& call, Args&&... args) -> sys_result<std::invoke_result_t<Syscall&, Args&...>>
+{
+    for (;;) {
+        auto res = sys_check(std::invoke(call, args...));
+
+        if constexpr (Eintr == sys_eintr::retry) {
+            if (res.is_error() && result_detail::access::get<1>(res) == std::errc::interrupted) continue;
+        }
+        return res;
+    }
+}
+
+#endif  // RESULT_SYS_H
+
+// MIT License
+//
+// Copyright (c) 2021 Alex Qzminsky
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
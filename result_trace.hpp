@@ -0,0 +1,278 @@
+#pragma once
+
+// Copyright © 2021 Alex Qzminsky.
+// License: MIT. All rights reserved.
+
+/// \brief Result variant type: error flow tracing
+///
+/// \details Included by `result.hpp` if `RESULT_TRACING` is defined. Otherwise the hooks
+/// expand to nothing and the buffers don't exist
+///
+/// \author https://github.com/qzminsky
+/// \version 0.1.0
+/// \date 2026/10/16
+
+#ifndef RESULT_TRACE_H
+#define RESULT_TRACE_H
+
+static_assert(__cplusplus >= 2020'00, "C++20 or higher is required for the tracing");
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <source_location>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifndef RESULT_TRACE_CAPACITY
+/// Number of events each thread buffer holds; must be a power of two
+#   define RESULT_TRACE_CAPACITY 4096
+#endif
+
+namespace result_trace
+{
+    /**
+     * \brief Traced step of an error flow
+    */
+    enum class kind : std::uint8_t
+    {
+        created,        ///< A failure result was constructed by `Error` or `result::error`
+        propagated,     ///< A failure result was returned to the caller by `RESULT_TRY`
+        handled         ///< A failure result was handled by `if_error`
+    };
+
+    /**
+     * \brief Traced event
+    */
+    struct event
+    {
+        /// Clock ticks: TSC on x86 with GCC or Clang, `steady_clock` otherwise
+        std::uint64_t timestamp;
+
+        /// Hash of the error value; `0` if the error type isn't hashable
+        std::uint64_t error_hash;
+
+        /// Call site: the file name is a static string, so its address and the line identify the site
+        char const* file;
+        std::uint32_t line;
+
+        kind step;
+    };
+
+    inline constexpr auto capacity = std::size_t{ RESULT_TRACE_CAPACITY };
+
+    static_assert(capacity != 0 && (capacity & (capacity - 1)) == 0, "RESULT_TRACE_CAPACITY must be a power of two");
+
+    namespace detail
+    {
+        /// Reads the trace clock
+        inline auto ticks () noexcept -> std::uint64_t
+        {
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+            return __builtin_ia32_rdtsc();
+#else
+            return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+        }
+
+        /// Hashes the error value if it's hashable
+        template <typename T>
+        auto error_hash (T const& err) noexcept -> std::uint64_t
+        {
+            if constexpr (std::is_default_constructible_v<std::hash<T>>) {
+                return static_cast<std::uint64_t>(std::hash<T>{}(err));
+            }
+            else return 0;
+        }
+
+        /// Single-producer single-consumer event queue of one thread. Full buffer drops new events
+        struct ring
+        {
+            alignas(64) std::atomic<std::size_t> head{ 0 };     // written by the producer
+            std::size_t cached_tail = 0;                        // producer's view of the tail
+            std::atomic<std::uint64_t> dropped{ 0 };
+
+            alignas(64) std::atomic<std::size_t> tail{ 0 };     // written by the consumer
+
+            event events[capacity];
+
+            auto push (event const& ev) noexcept -> void
+            {
+                auto const pos = head.load(std::memory_order_relaxed);
+
+                if (pos - cached_tail == capacity) {
+                    cached_tail = tail.load(std::memory_order_acquire);
+
+                    if (pos - cached_tail == capacity) {
+                        dropped.store(dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                        return;
+                    }
+                }
+                events[pos & (capacity - 1)] = ev;
+                head.store(pos + 1, std::memory_order_release);
+            }
+
+            template <typename Consumer>
+            auto pop_all (Consumer& consume) -> std::size_t
+            {
+                auto const from = tail.load(std::memory_order_relaxed);
+                auto const to = head.load(std::memory_order_acquire);
+
+                for (auto pos = from; pos != to; ++pos) {
+                    consume(std::as_const(events[pos & (capacity - 1)]));
+                }
+                tail.store(to, std::memory_order_release);
+
+                return to - from;
+            }
+        };
+
+        /// Buffers of all the threads. The buffers of finished threads are kept until drained
+        struct registry
+        {
+            std::mutex lock;
+            std::vector<std::shared_ptr<ring>> rings;
+            std::uint64_t dropped = 0;
+
+            static auto instance () -> registry&
+            {
+                static registry reg;
+                return reg;
+            }
+        };
+
+        /// Returns the buffer of the calling thread
+        inline auto local_ring () -> ring&
+        {
+            thread_local ring* cached = nullptr;
+
+            if (cached == nullptr) [[unlikely]] {
+                thread_local auto const owned = [] {
+                    auto buffer = std::make_shared<ring>();
+                    auto& reg = registry::instance();
+                    std::lock_guard guard{ reg.lock };
+
+                    reg.rings.push_back(buffer);
+                    return buffer;
+                }();
+                cached = owned.get();
+            }
+            return *cached;
+        }
+
+    }   // end namespace detail
+
+    /**
+     * \brief Pushes an event into the buffer of the calling thread
+     *
+     * \param step Traced step
+     * \param site Call site of the result operation
+     * \param err Error value
+    */
+    template <typename Error_t>
+    auto emit (kind step, std::source_location const& site, Error_t const& err) noexcept -> void
+    {
+        detail::local_ring().push(event{ detail::ticks(), detail::error_hash(err), site.file_name(), site.line(), step });
+    }
+
+    /**
+     * \brief Passes the buffered events of all the threads to the consumer and removes them
+     *
+     * \details Events of one thread are passed in order. Concurrent drains are serialized
+     *
+     * \param consume Functor taking `event const&`
+     *
+     * \return Number of drained events
+    */
+    template <typename Consumer>
+    auto drain (Consumer&& consume) -> std::size_t
+    {
+        auto& reg = detail::registry::instance();
+        std::lock_guard guard{ reg.lock };
+
+        auto count = std::size_t{ 0 };
+
+        for (auto const& buffer : reg.rings) {
+            count += buffer->pop_all(consume);
+        }
+
+        // Buffers owned only by the registry belong to finished threads
+        std::erase_if(reg.rings, [&](auto const& buffer) {
+            if (buffer.use_count() != 1) return false;
+
+            count += buffer->pop_all(consume);
+            reg.dropped += buffer->dropped.load(std::memory_order_relaxed);
+            return true;
+        });
+
+        return count;
+    }
+
+    /**
+     * \brief Writes the buffered events to a file, one per line: `timestamp step file:line hash`
+     *
+     * \param out Output file
+     *
+     * \return Number of drained events
+    */
+    inline auto drain (std::FILE* out) -> std::size_t
+    {
+        static char const* const steps[] = { "created", "propagated", "handled" };
+
+        return drain([out](event const& ev) {
+            std::fprintf(out, "%llu %s %s:%u %016llx\n",
+                static_cast<unsigned long long>(ev.timestamp),
+                steps[static_cast<std::size_t>(ev.step)],
+                ev.file, static_cast<unsigned>(ev.line),
+                static_cast<unsigned long long>(ev.error_hash)
+            );
+        });
+    }
+
+    /**
+     * \brief Returns the number of events dropped because a thread buffer was full
+    */
+    [[nodiscard]]
+    inline auto dropped () -> std::uint64_t
+    {
+        auto& reg = detail::registry::instance();
+        std::lock_guard guard{ reg.lock };
+
+        auto total = reg.dropped;
+
+        for (auto const& buffer : reg.rings) {
+            total += buffer->dropped.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+}   // end namespace result_trace
+
+#endif  // RESULT_TRACE_H
+
+// MIT License
+//
+// Copyright (c) 2021 Alex Qzminsky
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.